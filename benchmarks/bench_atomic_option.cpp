@@ -0,0 +1,98 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/AtomicOption.h"
+#include "../include/CppResultOption/Option.h"
+
+#include <cstdint>
+#include <mutex>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+struct Quad
+{
+    std::uint64_t a, b, c, d;
+};
+
+AtomicOption<std::uint32_t> atomicSlot;
+SeqLockOption<Quad> seqLockSlot;
+
+std::mutex mutex;
+Option<std::uint32_t> mutexSlot;
+Option<Quad> mutexQuad;
+
+} // namespace
+
+#pragma region Handoff
+/**
+ * Every thread either hands a value over or takes the pending one, so all of them contend on one slot.
+ */
+void AtomicOption_Handoff(benchmark::State& state)
+{
+    auto const value = static_cast<std::uint32_t>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        if (!atomicSlot.TryInsert(value)) benchmark::DoNotOptimize(atomicSlot.Take());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(AtomicOption_Handoff)->ThreadRange(1, 4)->UseRealTime();
+
+void MutexOption_Handoff(benchmark::State& state)
+{
+    auto const value = static_cast<std::uint32_t>(state.thread_index());
+
+    for (auto _ : state)
+    {
+        std::lock_guard const lock(mutex);
+        if (mutexSlot.IsNone())
+            mutexSlot = Some(value);
+        else
+            benchmark::DoNotOptimize(mutexSlot.Take());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MutexOption_Handoff)->ThreadRange(1, 4)->UseRealTime();
+#pragma endregion
+
+#pragma region ReadMostly
+/**
+ * Thread 0 writes, the rest read: the seqlock's readers never block the writer or each other.
+ */
+void SeqLockOption_ReadMostly(benchmark::State& state)
+{
+    std::uint64_t i = 0;
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+            seqLockSlot.Store(Some(Quad{i, i, i, ++i}));
+        else
+            benchmark::DoNotOptimize(seqLockSlot.Load());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(SeqLockOption_ReadMostly)->ThreadRange(1, 4)->UseRealTime();
+
+void MutexOption_ReadMostly(benchmark::State& state)
+{
+    std::uint64_t i = 0;
+    for (auto _ : state)
+    {
+        std::lock_guard const lock(mutex);
+        if (state.thread_index() == 0)
+            mutexQuad = Some(Quad{i, i, i, ++i});
+        else
+            benchmark::DoNotOptimize(mutexQuad);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(MutexOption_ReadMostly)->ThreadRange(1, 4)->UseRealTime();
+#pragma endregion
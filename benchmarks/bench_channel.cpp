@@ -0,0 +1,135 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/Channel.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <thread>
+#include <vector>
+
+using namespace m24;
+
+namespace
+{
+
+constexpr std::size_t Messages = 1 << 16;
+constexpr std::size_t BatchSize = 32;
+
+/**
+ * Pushes ``Messages`` values from ``pairs`` producers to ``pairs`` consumers, which drain until the channel closes.
+ */
+template<ChannelKind Kind, bool Batched>
+void Transfer(std::size_t pairs)
+{
+    Channel<std::uint64_t, Kind> channel(1024);
+    std::atomic<std::uint64_t> checksum{0};
+
+    std::vector<std::thread> consumers;
+    for (std::size_t c = 0; c < pairs; ++c)
+    {
+        consumers.emplace_back(
+            [&]
+            {
+                std::uint64_t sum = 0;
+                if constexpr (Batched)
+                {
+                    std::array<std::uint64_t, BatchSize> buffer;
+                    while (true)
+                    {
+                        std::size_t const received = channel.TryRecvBatch(buffer.begin(), buffer.size());
+                        for (std::size_t i = 0; i < received; ++i) sum += buffer[i];
+                        if (received != 0) continue;
+
+                        auto value = channel.Recv();
+                        if (value.IsErr()) break;
+                        sum += value.Unwrap();
+                    }
+                }
+                else
+                {
+                    for (auto value = channel.Recv(); value.IsOk(); value = channel.Recv()) sum += value.Unwrap();
+                }
+                checksum.fetch_add(sum, std::memory_order_relaxed);
+            });
+    }
+
+    std::vector<std::thread> producers;
+    for (std::size_t p = 0; p < pairs; ++p)
+    {
+        producers.emplace_back(
+            [&, p]
+            {
+                std::size_t const count = Messages / pairs;
+                if constexpr (Batched)
+                {
+                    std::array<std::uint64_t, BatchSize> buffer;
+                    for (std::size_t sent = 0; sent < count;)
+                    {
+                        std::size_t const size = std::min(BatchSize, count - sent);
+                        for (std::size_t i = 0; i < size; ++i) buffer[i] = p + sent + i;
+
+                        std::span<std::uint64_t> pending(buffer.data(), size);
+                        while (!pending.empty())
+                        {
+                            std::size_t const pushed = channel.TrySendBatch(pending);
+                            if (pushed == 0) std::this_thread::yield();
+                            pending = pending.subspan(pushed);
+                        }
+                        sent += size;
+                    }
+                }
+                else
+                {
+                    for (std::size_t i = 0; i < count; ++i) channel.Send(p + i);
+                }
+            });
+    }
+
+    for (std::thread& producer : producers) producer.join();
+    channel.Close();
+    for (std::thread& consumer : consumers) consumer.join();
+
+    benchmark::DoNotOptimize(checksum.load());
+}
+
+} // namespace
+
+#pragma region Mpmc
+void Channel_Mpmc(benchmark::State& state)
+{
+    for (auto _ : state) Transfer<ChannelKind::Mpmc, false>(static_cast<std::size_t>(state.range(0)));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Messages));
+}
+BENCHMARK(Channel_Mpmc)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+void Channel_MpmcBatch(benchmark::State& state)
+{
+    for (auto _ : state) Transfer<ChannelKind::Mpmc, true>(static_cast<std::size_t>(state.range(0)));
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Messages));
+}
+BENCHMARK(Channel_MpmcBatch)->Arg(1)->Arg(4)->Arg(16)->Arg(64)->UseRealTime()->Unit(benchmark::kMillisecond);
+#pragma endregion
+
+#pragma region Spsc
+void Channel_Spsc(benchmark::State& state)
+{
+    for (auto _ : state) Transfer<ChannelKind::Spsc, false>(1);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Messages));
+}
+BENCHMARK(Channel_Spsc)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+void Channel_SpscBatch(benchmark::State& state)
+{
+    for (auto _ : state) Transfer<ChannelKind::Spsc, true>(1);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(Messages));
+}
+BENCHMARK(Channel_SpscBatch)->UseRealTime()->Unit(benchmark::kMillisecond);
+#pragma endregion
@@ -0,0 +1,98 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/Generator.h"
+#include "../include/CppResultOption/Option.h"
+
+#include <cstdint>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+Generator<std::int64_t> Iota(std::int64_t count)
+{
+    for (std::int64_t i = 0; i < count; ++i) co_yield i;
+}
+
+/**
+ * The hand-written equivalent of ``Iota``: same ``Next()`` contract, no coroutine frame.
+ */
+class IotaIterator
+{
+private:
+    std::int64_t _next = 0;
+    std::int64_t _count;
+
+public:
+    explicit IotaIterator(std::int64_t count) noexcept
+        : _count(count)
+    {
+    }
+
+    Option<std::int64_t> Next() noexcept
+    {
+        if (_next == _count) return None;
+
+        return Some(_next++);
+    }
+};
+
+} // namespace
+
+#pragma region Iterate
+void Generator_Iterate(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (std::int64_t value : Iota(state.range(0))) sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Generator_Iterate)->Range(8, 1 << 16);
+
+void HandWritten_Iterate(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        IotaIterator iterator(state.range(0));
+        for (Option<std::int64_t> value = iterator.Next(); value.IsSome(); value = iterator.Next()) sum += *value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(HandWritten_Iterate)->Range(8, 1 << 16);
+#pragma endregion
+
+#pragma region Create
+/**
+ * Creating and draining a one-value generator: dominated by frame allocation, which the frame pool serves.
+ */
+void Generator_CreateShort(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Generator<std::int64_t> generator = Iota(1);
+        benchmark::DoNotOptimize(generator.Next());
+    }
+}
+BENCHMARK(Generator_CreateShort);
+
+void HandWritten_CreateShort(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        IotaIterator iterator(1);
+        benchmark::DoNotOptimize(iterator.Next());
+    }
+}
+BENCHMARK(HandWritten_CreateShort);
+#pragma endregion
@@ -0,0 +1,112 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/Option.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+using namespace m24;
+
+namespace
+{
+
+// Every seventh slot empty, so both branches of each loop stay live.
+std::vector<std::optional<std::int64_t>> MakeOptionals(std::size_t size)
+{
+    std::vector<std::optional<std::int64_t>> optionals(size);
+    for (std::size_t i = 0; i < size; ++i)
+        if (i % 7 != 0) optionals[i] = static_cast<std::int64_t>(i);
+
+    return optionals;
+}
+
+std::vector<Option<std::int64_t>> MakeOptions(std::size_t size)
+{
+    std::vector<Option<std::int64_t>> options;
+    options.reserve(size);
+    for (std::optional<std::int64_t> const& optional : MakeOptionals(size)) options.push_back(FromStd(optional));
+
+    return options;
+}
+
+} // namespace
+
+#pragma region FromStd
+/**
+ * The baseline every conversion below is measured against: the same sum over ``std::optional`` directly. ``AsStd``
+ * should match it; ``FromStd`` and ``ToStd`` build a new object per element, and Option's virtual destructor (from
+ * ``OptionBase``) keeps that construction from folding away entirely.
+ */
+void Raw_Sum(benchmark::State& state)
+{
+    std::vector<std::optional<std::int64_t>> const optionals = MakeOptionals(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (std::optional<std::int64_t> const& optional : optionals)
+            if (optional.has_value()) sum += *optional;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Raw_Sum)->Range(8, 1 << 16);
+
+void FromStd_Sum(benchmark::State& state)
+{
+    std::vector<std::optional<std::int64_t>> const optionals = MakeOptionals(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (std::optional<std::int64_t> const& optional : optionals)
+        {
+            Option<std::int64_t> const option = FromStd(optional);
+            if (option.IsSome()) sum += *option;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(FromStd_Sum)->Range(8, 1 << 16);
+#pragma endregion
+
+#pragma region ToStd
+void AsStd_Sum(benchmark::State& state)
+{
+    std::vector<Option<std::int64_t>> const options = MakeOptions(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (Option<std::int64_t> const& option : options)
+        {
+            std::optional<std::int64_t> const& optional = option.AsStd();
+            if (optional.has_value()) sum += *optional;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(AsStd_Sum)->Range(8, 1 << 16);
+
+void ToStd_Sum(benchmark::State& state)
+{
+    std::vector<Option<std::int64_t>> const options = MakeOptions(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        std::int64_t sum = 0;
+        for (Option<std::int64_t> const& option : options)
+        {
+            std::optional<std::int64_t> const optional = option.ToStd();
+            if (optional.has_value()) sum += *optional;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ToStd_Sum)->Range(8, 1 << 16);
+#pragma endregion
@@ -0,0 +1,108 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/NullableKernels.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/OptionVector.h"
+
+#include <cstddef>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+// Roughly 90% Some, the density a typical nullable column has.
+std::vector<Option<double>> MakeOptions(std::size_t size)
+{
+    std::vector<Option<double>> options;
+    options.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (i % 10 == 3)
+            options.push_back(NoneT<double>());
+        else
+            options.push_back(Some(static_cast<double>(i % 97)));
+    }
+    return options;
+}
+
+OptionVector<double> MakeColumn(std::size_t size)
+{
+    OptionVector<double> column;
+    for (Option<double> const& option : MakeOptions(size)) column.push_back(option);
+    return column;
+}
+
+} // namespace
+
+#pragma region Sum
+void OptionLoop_Sum(benchmark::State& state)
+{
+    std::vector<Option<double>> const options = MakeOptions(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        double sum = 0;
+        for (Option<double> const& option : options) sum += option.UnwrapOr(0.0);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(OptionLoop_Sum)->Range(1 << 10, 1 << 20);
+
+void Kernels_Sum(benchmark::State& state)
+{
+    OptionVector<double> const column = MakeColumn(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) benchmark::DoNotOptimize(Kernels::Sum(column));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Kernels_Sum)->Range(1 << 10, 1 << 20);
+
+void Kernels_SumScalar(benchmark::State& state)
+{
+    OptionVector<double> const column = MakeColumn(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) benchmark::DoNotOptimize(Kernels::internal::SumScalar(column.Values(), column.Validity()));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Kernels_SumScalar)->Range(1 << 10, 1 << 20);
+#pragma endregion
+
+#pragma region Map
+void OptionLoop_Map(benchmark::State& state)
+{
+    std::vector<Option<double>> const options = MakeOptions(static_cast<std::size_t>(state.range(0)));
+    auto half = [](double x) { return x * 0.5; };
+
+    for (auto _ : state)
+    {
+        std::vector<Option<double>> mapped;
+        mapped.reserve(options.size());
+        for (Option<double> const& option : options) mapped.push_back(option.Map<double>(half));
+        benchmark::DoNotOptimize(mapped.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(OptionLoop_Map)->Range(1 << 10, 1 << 20);
+
+void Kernels_Map(benchmark::State& state)
+{
+    OptionVector<double> const column = MakeColumn(static_cast<std::size_t>(state.range(0)));
+    auto half = [](double x) { return x * 0.5; };
+
+    for (auto _ : state)
+    {
+        OptionVector<double> mapped = Kernels::Map<double>(column, half);
+        benchmark::DoNotOptimize(mapped.Values().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Kernels_Map)->Range(1 << 10, 1 << 20);
+#pragma endregion
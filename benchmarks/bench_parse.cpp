@@ -0,0 +1,99 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/Parse.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace m24;
+
+namespace
+{
+
+// Every sixteenth field is malformed, so the error path is exercised without dominating.
+std::vector<std::string> MakeFields(std::size_t size)
+{
+    std::vector<std::string> fields;
+    fields.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+        fields.push_back(i % 16 == 5 ? "12ab" : std::to_string(static_cast<long>(i * 7919 % 1000003) - 500000));
+
+    return fields;
+}
+
+} // namespace
+
+#pragma region Integers
+void Parse_Integers(benchmark::State& state)
+{
+    std::vector<std::string> const fields = MakeFields(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (std::string const& field : fields)
+        {
+            Result<int, ParseError> const parsed = Parse<int>(field);
+            if (parsed.IsOk()) sum += *parsed;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Parse_Integers)->Range(8, 1 << 14);
+
+/**
+ * ``strtol`` with the end-pointer check ``Parse`` does implicitly: the nearest allocation-free C equivalent.
+ */
+void Strtol_Integers(benchmark::State& state)
+{
+    std::vector<std::string> const fields = MakeFields(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (std::string const& field : fields)
+        {
+            char* end = nullptr;
+            long const value = std::strtol(field.c_str(), &end, 10);
+            if (end == field.c_str() + field.size()) sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Strtol_Integers)->Range(8, 1 << 14);
+
+/**
+ * ``std::stoi`` ignores trailing characters, so ``12ab`` parses as 12 and nothing throws here; it does less checking
+ * than the other two and is a lower bound for the exception-based approach.
+ */
+void Stoi_Integers(benchmark::State& state)
+{
+    std::vector<std::string> const fields = MakeFields(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state)
+    {
+        long sum = 0;
+        for (std::string const& field : fields)
+        {
+            try
+            {
+                sum += std::stoi(field);
+            }
+            catch (std::exception const&)
+            {
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Stoi_Integers)->Range(8, 1 << 14);
+#pragma endregion
@@ -0,0 +1,107 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <benchmark/benchmark.h>
+
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/Task.h"
+#include "../include/CppResultOption/ThreadPool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+using IntResult = Result<int, std::string>;
+
+void ReportPercentiles(benchmark::State& state, std::vector<double>& latencies)
+{
+    if (latencies.empty()) return;
+
+    std::sort(latencies.begin(), latencies.end());
+    auto const at = [&](double quantile)
+    { return latencies[static_cast<std::size_t>(quantile * static_cast<double>(latencies.size() - 1))]; };
+
+    state.counters["p50_ns"] = at(0.50);
+    state.counters["p99_ns"] = at(0.99);
+    state.counters["p999_ns"] = at(0.999);
+}
+
+} // namespace
+
+#pragma region SpawnGet
+/**
+ * Round trip of one task: spawn, then block on ``Get``. Reports tail latency alongside the mean.
+ */
+void Task_SpawnGet(benchmark::State& state)
+{
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    std::vector<double> latencies;
+    latencies.reserve(1 << 16);
+
+    for (auto _ : state)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(Spawn(pool, [] { return IntResult(OkTag, 1); }).Get());
+        std::chrono::duration<double, std::nano> const elapsed = std::chrono::steady_clock::now() - start;
+
+        if (latencies.size() < latencies.capacity()) latencies.push_back(elapsed.count());
+    }
+
+    ReportPercentiles(state, latencies);
+}
+BENCHMARK(Task_SpawnGet)->Arg(1)->Arg(4)->UseRealTime();
+#pragma endregion
+
+#pragma region SpawnJoin
+/**
+ * Spawn/join throughput: a batch of tasks, each chained with ``Then``, joined in order.
+ */
+void Task_SpawnJoin(benchmark::State& state)
+{
+    ThreadPool pool(4);
+    auto const batch = static_cast<std::size_t>(state.range(0));
+    std::vector<Task<IntResult>> tasks;
+    tasks.reserve(batch);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < batch; ++i)
+        {
+            tasks.push_back(Spawn(pool, [i] { return IntResult(OkTag, static_cast<int>(i)); })
+                                .Then([](int x) { return x + 1; }));
+        }
+
+        int sum = 0;
+        for (Task<IntResult>& task : tasks) sum += std::move(task).Get().Unwrap();
+        tasks.clear();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(Task_SpawnJoin)->Range(64, 4096)->UseRealTime();
+#pragma endregion
+
+#pragma region ReadyChain
+/**
+ * Synchronously completed tasks chained inline: no allocation, no scheduler involvement.
+ */
+void Task_ReadyChain(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Task<IntResult> task(IntResult(OkTag, 1));
+        auto chained = std::move(task).Then([](int x) { return x * 2; }).Then([](int x) { return x + 1; });
+        benchmark::DoNotOptimize(std::move(chained).Get());
+    }
+}
+BENCHMARK(Task_ReadyChain);
+#pragma endregion
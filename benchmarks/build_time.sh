@@ -0,0 +1,81 @@
+#!/bin/sh
+#
+# Created by user1 on 18/10/2026.
+#
+# Times a synthetic many-TU project that uses Option and Result, built three ways: plain includes, a precompiled
+# header, and extern templates (M24_EXTERN_TEMPLATES plus one compile of src/Instantiations.cpp).
+#
+# Usage: benchmarks/build_time.sh [tu-count] [compiler]
+
+set -e
+
+count=${1:-32}
+cxx=${2:-g++}
+root=$(cd "$(dirname "$0")/.." && pwd)
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+
+flags="-std=c++23 -O2 -I$root/include"
+
+cat > "$work/common.h" <<HEADER
+#include <CppResultOption/Option.h>
+#include <CppResultOption/Result.h>
+
+#include <string>
+HEADER
+
+i=0
+while [ "$i" -lt "$count" ]; do
+    cat > "$work/tu$i.cpp" <<SOURCE
+#include "common.h"
+
+using namespace m24;
+using namespace m24::Prelude;
+
+int Use$i(int x, std::string const& text)
+{
+    Option<int> const some = x > 0 ? Some(x) : NoneT<int>();
+    Option<std::string> const name = text.empty() ? NoneT<std::string>() : Some(text);
+    Result<int, std::string> const parsed = x % 3 ? Ok<int, std::string>(x) : Err<int, std::string>(text);
+    Result<std::string, std::string> const joined = parsed.IsOk() ? Ok<std::string, std::string>(text + "!")
+                                                                   : Err<std::string, std::string>(text);
+
+    return some.UnwrapOr(0) + static_cast<int>(name.UnwrapOr("").size()) + parsed.UnwrapOr($i) +
+           static_cast<int>(joined.UnwrapOr("").size());
+}
+SOURCE
+    i=$((i + 1))
+done
+
+now() { date +%s.%N; }
+
+compile_all() {
+    i=0
+    while [ "$i" -lt "$count" ]; do
+        $cxx $flags "$@" -c "$work/tu$i.cpp" -o "$work/tu$i.o"
+        i=$((i + 1))
+    done
+}
+
+start=$(now)
+compile_all
+plain=$(awk "BEGIN { print $(now) - $start }")
+
+start=$(now)
+$cxx $flags -x c++-header "$work/common.h" -o "$work/common.h.gch"
+compile_all -Winvalid-pch
+pch=$(awk "BEGIN { print $(now) - $start }")
+rm "$work/common.h.gch"
+
+start=$(now)
+$cxx $flags -c "$root/src/Instantiations.cpp" -o "$work/instantiations.o"
+library=$(awk "BEGIN { print $(now) - $start }")
+
+start=$(now)
+compile_all -DM24_EXTERN_TEMPLATES
+extern=$(awk "BEGIN { print $(now) - $start }")
+
+printf '%s TUs with %s\n' "$count" "$cxx"
+printf '  includes          %6.2f s\n' "$plain"
+printf '  precompiled       %6.2f s\n' "$pch"
+printf '  extern templates  %6.2f s (plus %.2f s for the library)\n' "$extern" "$library"
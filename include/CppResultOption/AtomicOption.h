@@ -0,0 +1,443 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef ATOMIC_OPTION_H
+#define ATOMIC_OPTION_H
+
+#include "Option.h"
+#include "OptionNone.h"
+#include "OptionPrelude.h"
+#include "Unchecked.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+
+namespace m24
+{
+
+namespace internal
+{
+    /**
+     * Alignment used to keep independently contended atomics on separate cache lines.
+     * ``std::hardware_destructive_interference_size`` is avoided because GCC flags it as ABI-unstable in headers.
+     */
+    inline constexpr std::size_t CacheLineSize = 64;
+
+    /**
+     * Maps an ``Option<T>`` onto a single lock-free word. Only specialized for types with a spare bit pattern.
+     */
+    template<typename T>
+    struct AtomicOptionEncoding;
+
+    /**
+     * Pointers: None is the all-ones address, so ``Some(nullptr)`` stays distinct from None.
+     */
+    template<typename T>
+    struct AtomicOptionEncoding<T*>
+    {
+        using Word = std::uintptr_t;
+
+        static constexpr Word NoneWord = ~Word(0);
+
+        static Word Encode(T* value) noexcept
+        {
+            return reinterpret_cast<Word>(value);
+        }
+
+        static T* Decode(Word word) noexcept
+        {
+            return reinterpret_cast<T*>(word);
+        }
+    };
+
+    /**
+     * Trivially copyable payloads smaller than a 64-bit word: the value occupies the low bytes and the last byte
+     * is a presence flag, so None is the zero word.
+     */
+    template<typename T>
+        requires(std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && sizeof(T) < sizeof(std::uint64_t))
+    struct AtomicOptionEncoding<T>
+    {
+        using Word = std::uint64_t;
+
+        static constexpr Word NoneWord = 0;
+
+        static Word Encode(T const& value) noexcept
+        {
+            std::array<unsigned char, sizeof(Word)> bytes{};
+            std::memcpy(bytes.data(), &value, sizeof(T));
+            bytes.back() = 1;
+            return std::bit_cast<Word>(bytes);
+        }
+
+        static T Decode(Word word) noexcept
+        {
+            auto const bytes = std::bit_cast<std::array<unsigned char, sizeof(Word)>>(word);
+            T value;
+            std::memcpy(&value, bytes.data(), sizeof(T));
+            return value;
+        }
+    };
+
+    template<typename T>
+    concept AtomicOptionEncodable = requires { AtomicOptionEncoding<T>::NoneWord; };
+
+    inline void SpinPause() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#else
+        std::this_thread::yield();
+#endif
+    }
+} // namespace internal
+
+/**
+ * ``Option<T>`` held in a single lock-free atomic word, for hand-off slots, mailbox cells and lazily published
+ * pointers. Available for pointers and for trivially copyable types smaller than 8 bytes; larger trivially
+ * copyable payloads use ``SeqLockOption``.
+ *
+ * Values are compared by object representation, as ``std::atomic`` does, so ``CompareExchange`` on types with
+ * padding bytes may fail spuriously. The slot occupies its own cache line.
+ */
+template<typename T>
+    requires(internal::AtomicOptionEncodable<T>)
+class alignas(internal::CacheLineSize) AtomicOption
+{
+private:
+    using Encoding = internal::AtomicOptionEncoding<T>;
+    using Word = typename Encoding::Word;
+
+    std::atomic<Word> _word;
+
+    static Word Encode(Option<T> const& value) noexcept
+    {
+        return value.IsSome() ? Encoding::Encode(internal::Unchecked::Value(value)) : Encoding::NoneWord;
+    }
+
+    static Option<T> Decode(Word word) noexcept
+    {
+        if (word == Encoding::NoneWord) return Prelude::None;
+
+        return Prelude::Some(Encoding::Decode(word));
+    }
+
+public:
+    static constexpr bool IsAlwaysLockFree = std::atomic<Word>::is_always_lock_free;
+
+#pragma region Constructors
+    AtomicOption() noexcept
+        : _word(Encoding::NoneWord)
+    {
+    }
+
+    AtomicOption(Prelude::OptionNone const&) noexcept
+        : AtomicOption()
+    {
+    }
+
+    explicit AtomicOption(Option<T> const& value) noexcept
+        : _word(Encode(value))
+    {
+    }
+
+    AtomicOption(AtomicOption const&) = delete;
+    AtomicOption& operator=(AtomicOption const&) = delete;
+#pragma endregion
+
+#pragma region CompareExchange
+    /**
+     * Replaces the contents with ``desired`` if they currently equal ``expected``.
+     * On failure ``expected`` is updated to the current contents.
+     */
+    bool CompareExchange(Option<T>& expected, Option<T> const& desired,
+                         std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        Word expectedWord = Encode(expected);
+        if (_word.compare_exchange_strong(expectedWord, Encode(desired), order)) return true;
+
+        expected = Decode(expectedWord);
+        return false;
+    }
+#pragma endregion
+
+#pragma region IsNone
+    [[nodiscard]] bool IsNone(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return _word.load(order) == Encoding::NoneWord;
+    }
+#pragma endregion
+
+#pragma region IsSome
+    [[nodiscard]] bool IsSome(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return !IsNone(order);
+    }
+#pragma endregion
+
+#pragma region Load / Store
+    [[nodiscard]] Option<T> Load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+    {
+        return Decode(_word.load(order));
+    }
+
+    void Store(Option<T> const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        _word.store(Encode(value), order);
+    }
+#pragma endregion
+
+#pragma region Replace
+    /**
+     * Atomically stores ``Some(value)`` and returns the previous contents.
+     */
+    Option<T> Replace(T const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return Decode(_word.exchange(Encoding::Encode(value), order));
+    }
+#pragma endregion
+
+#pragma region Take
+    /**
+     * Atomically empties the slot and returns the previous contents; exactly one of several racing callers
+     * receives a given value.
+     */
+    Option<T> Take(std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        return Decode(_word.exchange(Encoding::NoneWord, order));
+    }
+#pragma endregion
+
+#pragma region TryInsert
+    /**
+     * Stores ``Some(value)`` only if the slot is None.
+     *
+     * @return Whether the value was inserted.
+     */
+    bool TryInsert(T const& value, std::memory_order order = std::memory_order_seq_cst) noexcept
+    {
+        Word expected = Encoding::NoneWord;
+        return _word.compare_exchange_strong(expected, Encoding::Encode(value), order);
+    }
+#pragma endregion
+};
+
+/**
+ * ``Option<T>`` for small trivially copyable payloads that do not fit a single atomic word.
+ *
+ * A sequence counter guards the payload: ``Load`` never blocks and retries only while a write is in flight,
+ * writers (``Store``, ``Take``, ``Replace``, ``TryInsert``, ``CompareExchange``) serialize on the counter with a
+ * short spin. The payload is kept in relaxed atomic words, so torn reads are detected rather than undefined.
+ * The slot occupies its own cache line(s).
+ */
+template<typename T>
+    requires(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+class alignas(internal::CacheLineSize) SeqLockOption
+{
+private:
+    // The payload bytes followed by a presence byte.
+    static constexpr std::size_t ByteCount = sizeof(T) + 1;
+    static constexpr std::size_t WordCount = (ByteCount + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+    using Words = std::array<std::uint64_t, WordCount>;
+
+    std::atomic<std::uint64_t> _sequence{0};
+    std::array<std::atomic<std::uint64_t>, WordCount> _words{};
+
+    static Words Encode(Option<T> const& value) noexcept
+    {
+        std::array<unsigned char, WordCount * sizeof(std::uint64_t)> bytes{};
+        if (value.IsSome())
+        {
+            std::memcpy(bytes.data(), &internal::Unchecked::Value(value), sizeof(T));
+            bytes[sizeof(T)] = 1;
+        }
+
+        return std::bit_cast<Words>(bytes);
+    }
+
+    static Option<T> Decode(Words const& words) noexcept
+    {
+        auto const bytes = std::bit_cast<std::array<unsigned char, WordCount * sizeof(std::uint64_t)>>(words);
+        if (bytes[sizeof(T)] == 0) return Prelude::None;
+
+        T value;
+        std::memcpy(&value, bytes.data(), sizeof(T));
+        return Prelude::Some(value);
+    }
+
+    Words ReadWords() const noexcept
+    {
+        Words words;
+        for (std::size_t i = 0; i < WordCount; ++i) words[i] = _words[i].load(std::memory_order_relaxed);
+        return words;
+    }
+
+    void WriteWords(Words const& words) noexcept
+    {
+        for (std::size_t i = 0; i < WordCount; ++i) _words[i].store(words[i], std::memory_order_relaxed);
+    }
+
+    /**
+     * Makes the sequence odd, waiting for any other writer to finish first.
+     *
+     * @return The (even) sequence value the write started from.
+     */
+    std::uint64_t BeginWrite() noexcept
+    {
+        std::uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+        while (true)
+        {
+            if ((sequence & 1) == 0 &&
+                _sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire,
+                                                std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            internal::SpinPause();
+            sequence = _sequence.load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+
+    void EndWrite(std::uint64_t sequence) noexcept
+    {
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Runs ``update(current)`` as a writer; the returned words, if any, become the new contents.
+     */
+    template<typename Update>
+    Option<T> Write(Update&& update) noexcept
+    {
+        std::uint64_t const sequence = BeginWrite();
+        Words const current = ReadWords();
+
+        if (auto const next = update(current); next.IsSome()) WriteWords(internal::Unchecked::Value(next));
+
+        EndWrite(sequence);
+        return Decode(current);
+    }
+
+public:
+#pragma region Constructors
+    SeqLockOption() noexcept = default;
+
+    SeqLockOption(Prelude::OptionNone const&) noexcept
+        : SeqLockOption()
+    {
+    }
+
+    explicit SeqLockOption(Option<T> const& value) noexcept
+    {
+        WriteWords(Encode(value));
+    }
+
+    SeqLockOption(SeqLockOption const&) = delete;
+    SeqLockOption& operator=(SeqLockOption const&) = delete;
+#pragma endregion
+
+#pragma region CompareExchange
+    /**
+     * Replaces the contents with ``desired`` if they currently equal ``expected`` (by object representation).
+     * On failure ``expected`` is updated to the current contents.
+     */
+    bool CompareExchange(Option<T>& expected, Option<T> const& desired) noexcept
+    {
+        Words const expectedWords = Encode(expected);
+        bool exchanged = false;
+
+        Option<T> const current = Write(
+            [&](Words const& words)
+            {
+                exchanged = words == expectedWords;
+                return exchanged ? Prelude::Some(Encode(desired)) : Prelude::NoneT<Words>();
+            });
+
+        if (!exchanged) expected = current;
+        return exchanged;
+    }
+#pragma endregion
+
+#pragma region IsNone
+    [[nodiscard]] bool IsNone() const noexcept
+    {
+        return Load().IsNone();
+    }
+#pragma endregion
+
+#pragma region IsSome
+    [[nodiscard]] bool IsSome() const noexcept
+    {
+        return Load().IsSome();
+    }
+#pragma endregion
+
+#pragma region Load / Store
+    /**
+     * Reads a consistent snapshot without blocking writers; retries while a write overlaps the read.
+     */
+    [[nodiscard]] Option<T> Load() const noexcept
+    {
+        while (true)
+        {
+            std::uint64_t const before = _sequence.load(std::memory_order_acquire);
+            if ((before & 1) == 0)
+            {
+                Words const words = ReadWords();
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (_sequence.load(std::memory_order_relaxed) == before) return Decode(words);
+            }
+
+            internal::SpinPause();
+        }
+    }
+
+    void Store(Option<T> const& value) noexcept
+    {
+        Write([next = Encode(value)](Words const&) { return Prelude::Some(next); });
+    }
+#pragma endregion
+
+#pragma region Replace
+    Option<T> Replace(T const& value) noexcept
+    {
+        return Write([next = Encode(Prelude::Some(value))](Words const&) { return Prelude::Some(next); });
+    }
+#pragma endregion
+
+#pragma region Take
+    Option<T> Take() noexcept
+    {
+        return Write([next = Encode(Prelude::None)](Words const&) { return Prelude::Some(next); });
+    }
+#pragma endregion
+
+#pragma region TryInsert
+    /**
+     * @return Whether the slot was None and now holds ``value``.
+     */
+    bool TryInsert(T const& value) noexcept
+    {
+        return Write(
+                   [next = Encode(Prelude::Some(value))](Words const& words)
+                   { return Decode(words).IsNone() ? Prelude::Some(next) : Prelude::NoneT<Words>(); })
+            .IsNone();
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // ATOMIC_OPTION_H
@@ -0,0 +1,29 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef CANCELLED_ERROR_H
+#define CANCELLED_ERROR_H
+
+#include <stdexcept>
+
+namespace m24
+{
+
+class CancelledError : public std::runtime_error
+{
+public:
+    CancelledError()
+        : std::runtime_error("Task cancelled")
+    {
+    }
+
+    CancelledError(std::string const& message)
+        : std::runtime_error(message)
+    {
+    }
+};
+
+} // namespace m24
+
+#endif // CANCELLED_ERROR_H
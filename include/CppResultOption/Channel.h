@@ -0,0 +1,514 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef CHANNEL_H
+#define CHANNEL_H
+
+#include "AtomicOption.h"
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "Result.h"
+#include "ResultTags.h"
+#include "Unchecked.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace m24
+{
+
+enum class ChannelError
+{
+    /// The channel has no free slot (``TrySend`` only).
+    Full,
+    /// The channel was closed: sends are rejected, receives fail once it is drained.
+    Closed,
+    /// ``Recv`` gave up after its timeout.
+    Timeout
+};
+
+/**
+ * Err of a send: why it failed, and the value that was not sent, handed back by move.
+ */
+template<typename T>
+struct SendError
+{
+    ChannelError reason;
+    T value;
+};
+
+enum class ChannelKind
+{
+    /// Any number of producers and consumers.
+    Mpmc,
+    /// Exactly one producer thread and one consumer thread.
+    Spsc
+};
+
+template<typename T, ChannelKind Kind = ChannelKind::Mpmc>
+class Channel;
+
+namespace internal
+{
+    /**
+     * Spin, then yield, then sleep: keeps short waits off the scheduler and long waits off the CPU.
+     */
+    class Backoff
+    {
+    private:
+        unsigned _step = 0;
+
+    public:
+        void Pause() noexcept
+        {
+            if (_step < 6)
+                for (unsigned i = 0; i < (1u << _step); ++i) SpinPause();
+            else if (_step < 12)
+                std::this_thread::yield();
+            else
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+
+            if (_step < 12) ++_step;
+        }
+    };
+
+    /**
+     * Uninitialized storage for one ``T``.
+     */
+    template<typename T>
+    struct ChannelSlot
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* Get() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        T Take() noexcept
+        {
+            T* value = Get();
+            T result = std::move(*value);
+            value->~T();
+            return result;
+        }
+    };
+
+    inline std::size_t ChannelCapacity(std::size_t requested) noexcept
+    {
+        return std::bit_ceil(std::max<std::size_t>(requested, 2));
+    }
+
+    /**
+     * The Result/Option surface shared by both channel kinds, built on the ring buffer's ``TryPush``, ``TryPop``
+     * and their batch forms.
+     */
+    template<typename Derived, typename T>
+    class ChannelBase
+    {
+    private:
+        std::atomic<bool> _closed{false};
+
+        Derived& Self() noexcept
+        {
+            return static_cast<Derived&>(*this);
+        }
+
+        static Result<std::monostate, SendError<T>> Sent() noexcept
+        {
+            return Result<std::monostate, SendError<T>>(OkTag, std::monostate());
+        }
+
+        static Result<std::monostate, SendError<T>> Rejected(ChannelError reason, T&& value)
+        {
+            return Result<std::monostate, SendError<T>>(ErrTag, SendError<T>{reason, std::move(value)});
+        }
+
+    protected:
+        ChannelBase() = default;
+
+    public:
+        using ValueType = T;
+
+        ChannelBase(ChannelBase const&) = delete;
+        ChannelBase& operator=(ChannelBase const&) = delete;
+
+#pragma region Close
+        /**
+         * Rejects further sends; receivers drain what is buffered and then get ``ChannelError::Closed``.
+         * A send racing with ``Close`` may still land.
+         */
+        void Close() noexcept
+        {
+            _closed.store(true, std::memory_order_release);
+        }
+
+        [[nodiscard]] bool IsClosed() const noexcept
+        {
+            return _closed.load(std::memory_order_acquire);
+        }
+#pragma endregion
+
+#pragma region Recv
+        /**
+         * Waits until a value arrives or the channel is closed and drained.
+         */
+        Result<T, ChannelError> Recv()
+        {
+            return Recv(std::chrono::steady_clock::duration::max());
+        }
+
+        /**
+         * Waits up to ``timeout`` for a value.
+         *
+         * @return The value, ``Err(Timeout)``, or ``Err(Closed)`` once the channel is closed and drained.
+         */
+        template<typename Rep, typename Period>
+        Result<T, ChannelError> Recv(std::chrono::duration<Rep, Period> timeout)
+        {
+            auto const start = std::chrono::steady_clock::now();
+            Backoff backoff;
+
+            while (true)
+            {
+                if (Option<T> value = Self().TryPop(); value.IsSome())
+                    return Result<T, ChannelError>(OkTag, Unchecked::Value(std::move(value)));
+
+                if (IsClosed())
+                {
+                    // Values sent before the close may have landed after the pop above.
+                    if (Option<T> value = Self().TryPop(); value.IsSome())
+                        return Result<T, ChannelError>(OkTag, Unchecked::Value(std::move(value)));
+
+                    return Result<T, ChannelError>(ErrTag, ChannelError::Closed);
+                }
+
+                if (std::chrono::steady_clock::now() - start >= timeout)
+                    return Result<T, ChannelError>(ErrTag, ChannelError::Timeout);
+
+                backoff.Pause();
+            }
+        }
+#pragma endregion
+
+#pragma region Send
+        /**
+         * Waits for a free slot. Fails only if the channel is closed, handing ``value`` back.
+         */
+        Result<std::monostate, SendError<T>> Send(T value)
+        {
+            Backoff backoff;
+            while (!IsClosed())
+            {
+                if (Self().TryPush(value)) return Sent();
+                backoff.Pause();
+            }
+
+            return Rejected(ChannelError::Closed, std::move(value));
+        }
+#pragma endregion
+
+#pragma region TryRecv
+        /**
+         * @return The oldest value, or None if the channel is empty right now.
+         */
+        Option<T> TryRecv()
+        {
+            return Self().TryPop();
+        }
+
+        /**
+         * Moves up to ``max`` values to ``out`` with one claim on the shared cursor.
+         *
+         * @return The number of values received.
+         */
+        template<typename OutputIterator>
+        std::size_t TryRecvBatch(OutputIterator out, std::size_t max)
+        {
+            return Self().TryPopBatch(out, max);
+        }
+#pragma endregion
+
+#pragma region TrySend
+        /**
+         * Sends ``value`` if there is room. On failure the value comes back inside the Err, moved, never copied.
+         */
+        Result<std::monostate, SendError<T>> TrySend(T value)
+        {
+            if (IsClosed()) return Rejected(ChannelError::Closed, std::move(value));
+            if (Self().TryPush(value)) return Sent();
+
+            return Rejected(ChannelError::Full, std::move(value));
+        }
+
+        /**
+         * Moves a prefix of ``values`` into the channel with one claim on the shared cursor.
+         *
+         * @return The number of values sent; elements past it are left untouched.
+         */
+        std::size_t TrySendBatch(std::span<T> values)
+        {
+            if (IsClosed() || values.empty()) return 0;
+
+            return Self().TryPushBatch(values);
+        }
+#pragma endregion
+    };
+} // namespace internal
+
+/**
+ * Bounded lock-free multi-producer multi-consumer channel: a ring of cells, each with a sequence counter that says
+ * whether it is free for the producer or filled for the consumer at a given position (Vyukov's bounded queue).
+ * Producers and consumers only contend on their own cursor, which lives on its own cache line.
+ */
+template<typename T>
+class Channel<T, ChannelKind::Mpmc> : public internal::ChannelBase<Channel<T, ChannelKind::Mpmc>, T>
+{
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        internal::ChannelSlot<T> slot;
+    };
+
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask;
+
+    alignas(internal::CacheLineSize) std::atomic<std::size_t> _enqueue{0};
+    alignas(internal::CacheLineSize) std::atomic<std::size_t> _dequeue{0};
+
+    friend class internal::ChannelBase<Channel, T>;
+
+    /**
+     * Claims up to ``max`` consecutive cells whose sequence equals ``position + k + offset``.
+     *
+     * @return The first claimed position and the number claimed (0 if none is ready).
+     */
+    std::pair<std::size_t, std::size_t> Claim(std::atomic<std::size_t>& cursor, std::size_t offset, std::size_t max)
+    {
+        std::size_t position = cursor.load(std::memory_order_relaxed);
+        while (true)
+        {
+            std::size_t ready = 0;
+            while (ready < max)
+            {
+                std::size_t const sequence =
+                    _cells[(position + ready) & _mask].sequence.load(std::memory_order_acquire);
+                if (sequence != position + ready + offset) break;
+                ++ready;
+            }
+
+            if (ready == 0)
+            {
+                std::size_t const sequence = _cells[position & _mask].sequence.load(std::memory_order_acquire);
+                auto const lag = static_cast<std::ptrdiff_t>(sequence - (position + offset));
+
+                // Behind: the ring is full (send) or empty (receive). Ahead: another thread moved the cursor.
+                if (lag < 0) return {position, 0};
+
+                position = cursor.load(std::memory_order_relaxed);
+                continue;
+            }
+
+            if (cursor.compare_exchange_weak(position, position + ready, std::memory_order_relaxed))
+                return {position, ready};
+        }
+    }
+
+    bool TryPush(T& value)
+    {
+        return TryPushBatch(std::span<T>(&value, 1)) == 1;
+    }
+
+    std::size_t TryPushBatch(std::span<T> values)
+    {
+        auto const [position, count] = Claim(_enqueue, 0, values.size());
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            Cell& cell = _cells[(position + k) & _mask];
+            std::construct_at(cell.slot.Get(), std::move(values[k]));
+            cell.sequence.store(position + k + 1, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    Option<T> TryPop()
+    {
+        auto const [position, count] = Claim(_dequeue, 1, 1);
+        if (count == 0) return Prelude::None;
+
+        Cell& cell = _cells[position & _mask];
+        T value = cell.slot.Take();
+        cell.sequence.store(position + _mask + 1, std::memory_order_release);
+        return Option<T>(std::move(value));
+    }
+
+    template<typename OutputIterator>
+    std::size_t TryPopBatch(OutputIterator out, std::size_t max)
+    {
+        auto const [position, count] = Claim(_dequeue, 1, max);
+        for (std::size_t k = 0; k < count; ++k)
+        {
+            Cell& cell = _cells[(position + k) & _mask];
+            *out++ = cell.slot.Take();
+            cell.sequence.store(position + k + _mask + 1, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+public:
+#pragma region Constructors
+    /**
+     * @param capacity Minimum number of buffered values; rounded up to a power of two.
+     */
+    explicit Channel(std::size_t capacity)
+        : _cells(std::make_unique<Cell[]>(internal::ChannelCapacity(capacity))),
+          _mask(internal::ChannelCapacity(capacity) - 1)
+    {
+        for (std::size_t i = 0; i <= _mask; ++i) _cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    ~Channel()
+    {
+        while (TryPop().IsSome())
+        {
+        }
+    }
+#pragma endregion
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return _mask + 1;
+    }
+
+    /**
+     * @return Number of buffered values; a snapshot that may be stale by the time it is read.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        std::size_t const dequeue = _dequeue.load(std::memory_order_relaxed);
+        std::size_t const enqueue = _enqueue.load(std::memory_order_relaxed);
+        return enqueue > dequeue ? std::min(enqueue - dequeue, capacity()) : 0;
+    }
+};
+
+/**
+ * Bounded single-producer single-consumer channel. Each side owns one cursor and caches the other's, so the common
+ * case touches no shared cache line; batches publish many values with a single release store.
+ */
+template<typename T>
+class Channel<T, ChannelKind::Spsc> : public internal::ChannelBase<Channel<T, ChannelKind::Spsc>, T>
+{
+private:
+    std::unique_ptr<internal::ChannelSlot<T>[]> _slots;
+    std::size_t _mask;
+
+    // Producer side.
+    alignas(internal::CacheLineSize) std::atomic<std::size_t> _tail{0};
+    std::size_t _cachedHead = 0;
+
+    // Consumer side.
+    alignas(internal::CacheLineSize) std::atomic<std::size_t> _head{0};
+    std::size_t _cachedTail = 0;
+
+    friend class internal::ChannelBase<Channel, T>;
+
+    bool TryPush(T& value)
+    {
+        return TryPushBatch(std::span<T>(&value, 1)) == 1;
+    }
+
+    std::size_t TryPushBatch(std::span<T> values)
+    {
+        std::size_t const tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _cachedHead + values.size() > capacity()) _cachedHead = _head.load(std::memory_order_acquire);
+
+        std::size_t const count = std::min(values.size(), capacity() - (tail - _cachedHead));
+        for (std::size_t k = 0; k < count; ++k)
+            std::construct_at(_slots[(tail + k) & _mask].Get(), std::move(values[k]));
+
+        if (count != 0) _tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    Option<T> TryPop()
+    {
+        std::size_t const head = _head.load(std::memory_order_relaxed);
+        if (head == _cachedTail)
+        {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if (head == _cachedTail) return Prelude::None;
+        }
+
+        T value = _slots[head & _mask].Take();
+        _head.store(head + 1, std::memory_order_release);
+        return Option<T>(std::move(value));
+    }
+
+    template<typename OutputIterator>
+    std::size_t TryPopBatch(OutputIterator out, std::size_t max)
+    {
+        std::size_t const head = _head.load(std::memory_order_relaxed);
+        if (_cachedTail - head < max) _cachedTail = _tail.load(std::memory_order_acquire);
+
+        std::size_t const count = std::min(max, _cachedTail - head);
+        for (std::size_t k = 0; k < count; ++k) *out++ = _slots[(head + k) & _mask].Take();
+
+        if (count != 0) _head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+public:
+#pragma region Constructors
+    /**
+     * @param capacity Minimum number of buffered values; rounded up to a power of two.
+     */
+    explicit Channel(std::size_t capacity)
+        : _slots(std::make_unique<internal::ChannelSlot<T>[]>(internal::ChannelCapacity(capacity))),
+          _mask(internal::ChannelCapacity(capacity) - 1)
+    {
+    }
+
+    ~Channel()
+    {
+        while (TryPop().IsSome())
+        {
+        }
+    }
+#pragma endregion
+
+    [[nodiscard]] std::size_t capacity() const noexcept
+    {
+        return _mask + 1;
+    }
+
+    /**
+     * @return Number of buffered values; a snapshot that may be stale by the time it is read.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        std::size_t const head = _head.load(std::memory_order_relaxed);
+        std::size_t const tail = _tail.load(std::memory_order_relaxed);
+        return tail > head ? tail - head : 0;
+    }
+};
+
+template<typename T>
+using SpscChannel = Channel<T, ChannelKind::Spsc>;
+
+} // namespace m24
+
+#endif // CHANNEL_H
@@ -0,0 +1,471 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef CODEC_H
+#define CODEC_H
+
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "Result.h"
+#include "Unchecked.h"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace m24
+{
+
+enum class EncodeError
+{
+    /// The caller-supplied buffer has no room left; nothing of the rejected value was written.
+    BufferFull,
+};
+
+enum class DecodeError
+{
+    Truncated,
+    InvalidTag,
+    /// A varint longer than 10 bytes, or one that does not fit the decoded type.
+    InvalidVarint,
+    /// Bytes that are not a valid value of the decoded type, such as a ``bool`` other than 0 or 1.
+    InvalidValue,
+};
+
+/**
+ * Appends to a caller-supplied buffer, never allocating. Every ``Encode`` either writes its whole value or, if the
+ * buffer is too small, writes nothing and returns ``BufferFull``, so a full buffer can be flushed and retried.
+ */
+class Encoder
+{
+private:
+    std::span<std::byte> _buffer;
+    std::size_t _position = 0;
+
+public:
+    explicit Encoder(std::span<std::byte> buffer) noexcept
+        : _buffer(buffer)
+    {
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _position;
+    }
+
+    [[nodiscard]] std::size_t Remaining() const noexcept
+    {
+        return _buffer.size() - _position;
+    }
+
+    [[nodiscard]] std::span<std::byte const> Written() const noexcept
+    {
+        return _buffer.first(_position);
+    }
+
+    /**
+     * Forgets everything written, e.g. after the caller has flushed ``Written()``.
+     */
+    void Reset() noexcept
+    {
+        _position = 0;
+    }
+
+    /**
+     * Moves the write position back to ``position``, a value of ``size()`` taken earlier.
+     */
+    void Rewind(std::size_t position) noexcept
+    {
+        _position = position;
+    }
+
+    Result<std::monostate, EncodeError> WriteBytes(std::span<std::byte const> bytes) noexcept
+    {
+        if (bytes.size() > Remaining()) return Result<std::monostate, EncodeError>(ErrTag, EncodeError::BufferFull);
+
+        if (!bytes.empty()) std::memcpy(_buffer.data() + _position, bytes.data(), bytes.size());
+        _position += bytes.size();
+        return Result<std::monostate, EncodeError>(OkTag, std::monostate());
+    }
+
+    Result<std::monostate, EncodeError> WriteByte(std::uint8_t byte) noexcept
+    {
+        return WriteBytes(std::as_bytes(std::span(&byte, 1)));
+    }
+
+    /**
+     * LEB128: seven bits per byte, low bits first, high bit set on every byte but the last.
+     */
+    Result<std::monostate, EncodeError> WriteVarint(std::uint64_t value) noexcept
+    {
+        std::uint8_t bytes[10];
+        std::size_t count = 0;
+
+        do
+        {
+            std::uint8_t const low = value & 0x7F;
+            value >>= 7;
+            bytes[count++] = value != 0 ? (low | 0x80) : low;
+        }
+        while (value != 0);
+
+        return WriteBytes(std::as_bytes(std::span(bytes, count)));
+    }
+};
+
+/**
+ * Reads from a byte buffer with every access bounds-checked; nothing throws.
+ */
+class Decoder
+{
+private:
+    std::span<std::byte const> _buffer;
+    std::size_t _position = 0;
+
+public:
+    explicit Decoder(std::span<std::byte const> buffer) noexcept
+        : _buffer(buffer)
+    {
+    }
+
+    [[nodiscard]] std::size_t Position() const noexcept
+    {
+        return _position;
+    }
+
+    [[nodiscard]] std::size_t Remaining() const noexcept
+    {
+        return _buffer.size() - _position;
+    }
+
+    /**
+     * @return A view of the next ``count`` bytes, referencing the input buffer.
+     */
+    Result<std::span<std::byte const>, DecodeError> ReadBytes(std::size_t count) noexcept
+    {
+        using Read = Result<std::span<std::byte const>, DecodeError>;
+
+        if (count > Remaining()) return Read(ErrTag, DecodeError::Truncated);
+
+        std::span<std::byte const> const bytes = _buffer.subspan(_position, count);
+        _position += count;
+        return Read(OkTag, bytes);
+    }
+
+    Result<std::uint8_t, DecodeError> ReadByte() noexcept
+    {
+        if (Remaining() == 0) return Result<std::uint8_t, DecodeError>(ErrTag, DecodeError::Truncated);
+
+        return Result<std::uint8_t, DecodeError>(OkTag, std::to_integer<std::uint8_t>(_buffer[_position++]));
+    }
+
+    Result<std::uint64_t, DecodeError> ReadVarint() noexcept
+    {
+        using Read = Result<std::uint64_t, DecodeError>;
+
+        std::uint64_t value = 0;
+        for (unsigned shift = 0; shift < 70; shift += 7)
+        {
+            Result<std::uint8_t, DecodeError> byte = ReadByte();
+            if (byte.IsErr()) return Read(ErrTag, internal::Unchecked::Err(byte));
+
+            std::uint8_t const bits = internal::Unchecked::Value(byte);
+            if (shift == 63 && (bits & 0xFE) != 0) return Read(ErrTag, DecodeError::InvalidVarint);
+
+            value |= static_cast<std::uint64_t>(bits & 0x7F) << shift;
+            if ((bits & 0x80) == 0) return Read(OkTag, value);
+        }
+
+        return Read(ErrTag, DecodeError::InvalidVarint);
+    }
+};
+
+/**
+ * Types encoded as their raw object representation: fixed width, native byte order, no framing. Every byte must
+ * belong to the value, so structs with padding are excluded (they would leak uninitialized bytes), and every byte
+ * pattern must be a valid value, so ``bool`` is excluded and gets its own checked codec.
+ */
+template<typename T>
+concept FixedWidthCodable = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && !std::same_as<T, bool> &&
+                            (std::has_unique_object_representations_v<T> || std::floating_point<T>) &&
+                            !internal::OptionLike<T> && !internal::ResultLike<T>;
+
+/**
+ * Binary codec for ``T``. Specialize it for other types with
+ * ``static Result<std::monostate, EncodeError> Encode(Encoder&, T const&)`` and
+ * ``static Result<T, DecodeError> Decode(Decoder&)``; Option, Result and vectors of them pick it up.
+ */
+template<typename T>
+struct Codec;
+
+template<FixedWidthCodable T>
+struct Codec<T>
+{
+    static Result<std::monostate, EncodeError> Encode(Encoder& encoder, T const& value) noexcept
+    {
+        return encoder.WriteBytes(std::as_bytes(std::span(&value, 1)));
+    }
+
+    static Result<T, DecodeError> Decode(Decoder& decoder) noexcept
+    {
+        Result<std::span<std::byte const>, DecodeError> bytes = decoder.ReadBytes(sizeof(T));
+        if (bytes.IsErr()) return Result<T, DecodeError>(ErrTag, internal::Unchecked::Err(bytes));
+
+        T value;
+        std::memcpy(&value, internal::Unchecked::Value(bytes).data(), sizeof(T));
+        return Result<T, DecodeError>(OkTag, value);
+    }
+};
+
+template<>
+struct Codec<bool>
+{
+    static Result<std::monostate, EncodeError> Encode(Encoder& encoder, bool value) noexcept
+    {
+        return encoder.WriteByte(value ? 1 : 0);
+    }
+
+    static Result<bool, DecodeError> Decode(Decoder& decoder) noexcept
+    {
+        Result<std::uint8_t, DecodeError> byte = decoder.ReadByte();
+        if (byte.IsErr()) return Result<bool, DecodeError>(ErrTag, internal::Unchecked::Err(byte));
+        if (internal::Unchecked::Value(byte) > 1) return Result<bool, DecodeError>(ErrTag, DecodeError::InvalidValue);
+
+        return Result<bool, DecodeError>(OkTag, internal::Unchecked::Value(byte) == 1);
+    }
+};
+
+template<>
+struct Codec<std::string>
+{
+    static Result<std::monostate, EncodeError> Encode(Encoder& encoder, std::string const& value) noexcept
+    {
+        std::size_t const start = encoder.size();
+
+        Result<std::monostate, EncodeError> written = encoder.WriteVarint(value.size());
+        if (written.IsOk()) written = encoder.WriteBytes(std::as_bytes(std::span(value)));
+        if (written.IsErr()) encoder.Rewind(start);
+
+        return written;
+    }
+
+    static Result<std::string, DecodeError> Decode(Decoder& decoder)
+    {
+        using Decoded = Result<std::string, DecodeError>;
+
+        Result<std::uint64_t, DecodeError> length = decoder.ReadVarint();
+        if (length.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(length));
+
+        Result<std::span<std::byte const>, DecodeError> bytes = decoder.ReadBytes(internal::Unchecked::Value(length));
+        if (bytes.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(bytes));
+
+        std::span<std::byte const> const text = internal::Unchecked::Value(bytes);
+        return Decoded(OkTag, std::string(reinterpret_cast<char const*>(text.data()), text.size()));
+    }
+};
+
+/**
+ * One tag byte, 0 for None and 1 for Some, followed by the Some payload.
+ */
+template<typename T>
+struct Codec<Option<T>>
+{
+    static Result<std::monostate, EncodeError> Encode(Encoder& encoder, Option<T> const& option)
+    {
+        std::size_t const start = encoder.size();
+
+        Result<std::monostate, EncodeError> written = encoder.WriteByte(option.IsSome() ? 1 : 0);
+        if (written.IsOk() && option.IsSome())
+            written = Codec<T>::Encode(encoder, internal::Unchecked::Value(option));
+        if (written.IsErr()) encoder.Rewind(start);
+
+        return written;
+    }
+
+    static Result<Option<T>, DecodeError> Decode(Decoder& decoder)
+    {
+        using Decoded = Result<Option<T>, DecodeError>;
+
+        Result<std::uint8_t, DecodeError> tag = decoder.ReadByte();
+        if (tag.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(tag));
+
+        switch (internal::Unchecked::Value(tag))
+        {
+        case 0: return Decoded(OkTag, Option<T>());
+        case 1:
+        {
+            Result<T, DecodeError> value = Codec<T>::Decode(decoder);
+            if (value.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(std::move(value)));
+
+            return Decoded(OkTag, Option<T>(internal::Unchecked::Value(std::move(value))));
+        }
+        default: return Decoded(ErrTag, DecodeError::InvalidTag);
+        }
+    }
+};
+
+/**
+ * One tag byte, 0 for Ok and 1 for Err, followed by that side's payload.
+ */
+template<typename T, typename E>
+struct Codec<Result<T, E>>
+{
+    static Result<std::monostate, EncodeError> Encode(Encoder& encoder, Result<T, E> const& result)
+    {
+        std::size_t const start = encoder.size();
+
+        Result<std::monostate, EncodeError> written = encoder.WriteByte(result.IsOk() ? 0 : 1);
+        if (written.IsOk())
+        {
+            written = result.IsOk() ? Codec<T>::Encode(encoder, internal::Unchecked::Value(result))
+                                    : Codec<E>::Encode(encoder, internal::Unchecked::Err(result));
+        }
+        if (written.IsErr()) encoder.Rewind(start);
+
+        return written;
+    }
+
+    static Result<Result<T, E>, DecodeError> Decode(Decoder& decoder)
+    {
+        using Decoded = Result<Result<T, E>, DecodeError>;
+
+        Result<std::uint8_t, DecodeError> tag = decoder.ReadByte();
+        if (tag.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(tag));
+
+        switch (internal::Unchecked::Value(tag))
+        {
+        case 0:
+        {
+            Result<T, DecodeError> value = Codec<T>::Decode(decoder);
+            if (value.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(std::move(value)));
+
+            return Decoded(OkTag, Result<T, E>(OkTag, internal::Unchecked::Value(std::move(value))));
+        }
+        case 1:
+        {
+            Result<E, DecodeError> error = Codec<E>::Decode(decoder);
+            if (error.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(std::move(error)));
+
+            return Decoded(OkTag, Result<T, E>(ErrTag, internal::Unchecked::Value(std::move(error))));
+        }
+        default: return Decoded(ErrTag, DecodeError::InvalidTag);
+        }
+    }
+};
+
+template<typename T>
+concept Codable = requires(Encoder& encoder, Decoder& decoder, T const& value) {
+    { Codec<T>::Encode(encoder, value) } -> std::same_as<Result<std::monostate, EncodeError>>;
+    { Codec<T>::Decode(decoder) } -> std::same_as<Result<T, DecodeError>>;
+};
+
+#pragma region Encode
+/**
+ * Writes ``value`` whole, or nothing on ``BufferFull``.
+ */
+template<Codable T>
+Result<std::monostate, EncodeError> Encode(Encoder& encoder, T const& value)
+{
+    return Codec<T>::Encode(encoder, value);
+}
+
+/**
+ * Encodes a batch of fixed-width options as a varint count, an LSB-first validity bitmap of ``ceil(n / 8)`` bytes,
+ * then the Some payloads packed back to back, so the None slots cost one bit each.
+ */
+template<FixedWidthCodable T>
+Result<std::monostate, EncodeError> EncodeBatch(Encoder& encoder, std::vector<Option<T>> const& batch)
+{
+    std::size_t const start = encoder.size();
+    std::size_t const bitmapBytes = (batch.size() + 7) / 8;
+    auto fail = [&]
+    {
+        encoder.Rewind(start);
+        return Result<std::monostate, EncodeError>(ErrTag, EncodeError::BufferFull);
+    };
+
+    if (encoder.WriteVarint(batch.size()).IsErr() || encoder.Remaining() < bitmapBytes) return fail();
+
+    for (std::size_t byte = 0; byte < bitmapBytes; ++byte)
+    {
+        std::uint8_t bits = 0;
+        for (std::size_t bit = 0; bit < 8 && byte * 8 + bit < batch.size(); ++bit)
+            bits |= static_cast<std::uint8_t>(batch[byte * 8 + bit].IsSome()) << bit;
+
+        encoder.WriteByte(bits);
+    }
+
+    for (Option<T> const& option : batch)
+        if (option.IsSome() && Codec<T>::Encode(encoder, internal::Unchecked::Value(option)).IsErr()) return fail();
+
+    return Result<std::monostate, EncodeError>(OkTag, std::monostate());
+}
+#pragma endregion
+
+#pragma region Decode
+/**
+ * Reads one ``T``. On failure the decoder may have advanced partway; decode errors are terminal for a stream.
+ */
+template<Codable T>
+Result<T, DecodeError> Decode(Decoder& decoder)
+{
+    return Codec<T>::Decode(decoder);
+}
+
+/**
+ * Reads a batch written by ``EncodeBatch``. Sizes are checked against the remaining input before anything is
+ * allocated, so a corrupt count cannot trigger a huge allocation.
+ */
+template<FixedWidthCodable T>
+Result<std::vector<Option<T>>, DecodeError> DecodeBatch(Decoder& decoder)
+{
+    using Decoded = Result<std::vector<Option<T>>, DecodeError>;
+
+    Result<std::uint64_t, DecodeError> count = decoder.ReadVarint();
+    if (count.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(count));
+
+    std::uint64_t const size = internal::Unchecked::Value(count);
+    if (size / 8 > decoder.Remaining()) return Decoded(ErrTag, DecodeError::Truncated);
+
+    Result<std::span<std::byte const>, DecodeError> bitmap = decoder.ReadBytes((size + 7) / 8);
+    if (bitmap.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(bitmap));
+    std::span<std::byte const> const bits = internal::Unchecked::Value(bitmap);
+
+    std::size_t somes = 0;
+    for (std::size_t i = 0; i < size; ++i) somes += std::to_integer<unsigned>(bits[i / 8] >> (i % 8)) & 1;
+
+    Result<std::span<std::byte const>, DecodeError> blob = decoder.ReadBytes(somes * sizeof(T));
+    if (blob.IsErr()) return Decoded(ErrTag, internal::Unchecked::Err(blob));
+    std::byte const* payload = internal::Unchecked::Value(blob).data();
+
+    std::vector<Option<T>> batch;
+    batch.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if ((std::to_integer<unsigned>(bits[i / 8] >> (i % 8)) & 1) == 0)
+        {
+            batch.emplace_back();
+            continue;
+        }
+
+        T value;
+        std::memcpy(&value, payload, sizeof(T));
+        payload += sizeof(T);
+        batch.emplace_back(value);
+    }
+
+    return Decoded(OkTag, std::move(batch));
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // CODEC_H
@@ -0,0 +1,135 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef COLLECT_H
+#define COLLECT_H
+
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "Result.h"
+#include "ResultPrelude.h"
+#include "Unchecked.h"
+
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace m24
+{
+
+namespace internal
+{
+    template<typename Container, typename Range>
+    void ReserveFor(Container& container, Range& range, std::size_t extra = 0)
+    {
+        if constexpr (std::ranges::sized_range<Range> && requires { container.reserve(std::size_t{}); })
+            container.reserve(static_cast<std::size_t>(std::ranges::size(range)) + extra);
+    }
+
+    template<typename Container, typename Value>
+    void AppendTo(Container& container, Value&& value)
+    {
+        if constexpr (requires { container.push_back(std::forward<Value>(value)); })
+            container.push_back(std::forward<Value>(value));
+        else
+            container.insert(std::forward<Value>(value));
+    }
+
+    template<typename Container, typename Default>
+    using ContainerOr = std::conditional_t<std::is_void_v<Container>, Default, Container>;
+} // namespace internal
+
+#pragma region Collect
+/**
+ * Turns a range of ``Option<T>`` into ``Option<Container>``, stopping at the first None.
+ * @tparam Container Output container, ``std::vector<T>`` by default; anything with ``push_back`` or ``insert``.
+ */
+template<typename Container = void, std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+auto Collect(Range&& options)
+{
+    using T = typename internal::OptionTraits<std::ranges::range_value_t<Range>>::ValueType;
+    using Output = internal::ContainerOr<Container, std::vector<T>>;
+
+    Output output;
+    internal::ReserveFor(output, options);
+
+    for (auto&& option : options)
+    {
+        if (option.IsNone()) return Option<Output>();
+
+        internal::AppendTo(output, internal::ForwardValue<Range>(option));
+    }
+
+    return Option<Output>(std::move(output));
+}
+
+/**
+ * Turns a range of ``Result<T, E>`` into ``Result<Container, E>``, stopping at the first Err.
+ * @tparam Container Output container, ``std::vector<T>`` by default; anything with ``push_back`` or ``insert``.
+ */
+template<typename Container = void, std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+auto Collect(Range&& results)
+{
+    using Traits = internal::ResultTraits<std::ranges::range_value_t<Range>>;
+    using Output = internal::ContainerOr<Container, std::vector<typename Traits::ValueType>>;
+    using E = typename Traits::ErrorType;
+
+    Output output;
+    internal::ReserveFor(output, results);
+
+    for (auto&& result : results)
+    {
+        if (result.IsErr()) return Result<Output, E>(ErrTag, internal::ForwardErr<Range>(result));
+
+        internal::AppendTo(output, internal::ForwardValue<Range>(result));
+    }
+
+    return Result<Output, E>(OkTag, std::move(output));
+}
+#pragma endregion
+
+#pragma region Partition
+/**
+ * Splits a range of ``Result<T, E>`` into its Ok values and its Err values in a single pass.
+ * For sized forward ranges the Oks are counted first (reading only the state) so both outputs are reserved exactly.
+ */
+template<typename OkContainer = void, typename ErrContainer = void, std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+auto Partition(Range&& results)
+{
+    using Traits = internal::ResultTraits<std::ranges::range_value_t<Range>>;
+    using Oks = internal::ContainerOr<OkContainer, std::vector<typename Traits::ValueType>>;
+    using Errs = internal::ContainerOr<ErrContainer, std::vector<typename Traits::ErrorType>>;
+
+    std::pair<Oks, Errs> output;
+
+    if constexpr (std::ranges::forward_range<Range> && std::ranges::sized_range<Range>)
+    {
+        std::size_t okCount = 0;
+        for (auto const& result : results) okCount += result.IsOk();
+
+        if constexpr (requires { output.first.reserve(okCount); }) output.first.reserve(okCount);
+        if constexpr (requires { output.second.reserve(okCount); })
+            output.second.reserve(static_cast<std::size_t>(std::ranges::size(results)) - okCount);
+    }
+
+    for (auto&& result : results)
+    {
+        if (result.IsOk())
+            internal::AppendTo(output.first, internal::ForwardValue<Range>(result));
+        else
+            internal::AppendTo(output.second, internal::ForwardErr<Range>(result));
+    }
+
+    return output;
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // COLLECT_H
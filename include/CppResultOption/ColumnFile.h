@@ -0,0 +1,498 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef COLUMN_FILE_H
+#define COLUMN_FILE_H
+
+#include "Io.h"
+#include "IoError.h"
+#include "Option.h"
+#include "OptionRef.h"
+#include "Result.h"
+#include "Unchecked.h"
+#include "ValidityBitmap.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace m24
+{
+
+/**
+ * Element types a column file can hold: stored as raw bytes and referenced in place once mapped.
+ */
+template<typename T>
+concept ColumnValue = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && alignof(T) <= 64;
+
+enum class ColumnFormatError
+{
+    BadMagic,
+    UnsupportedVersion,
+    /// Element size, alignment or byte order differ from what the reader expects.
+    TypeMismatch,
+    Truncated,
+};
+
+using ColumnError = std::variant<io::IoError, ColumnFormatError>;
+
+/**
+ * ``madvise`` hint applied to a mapped column.
+ */
+enum class ColumnAccess
+{
+    Normal,
+    Sequential,
+    Random,
+    /// Start reading the whole file in ahead of use.
+    WillNeed,
+};
+
+namespace internal
+{
+    /**
+     * On-disk layout, version 1, native byte order:
+     *
+     * | offset          | contents                                                 |
+     * |-----------------|----------------------------------------------------------|
+     * | 0               | ``ColumnHeader``                                         |
+     * | ``valuesOffset``| ``size`` values of ``valueSize`` bytes (None slots zero) |
+     * | ``bitmapOffset``| ``ceil(size / 64)`` validity words, 8-byte aligned       |
+     *
+     * The value column starts on a 64-byte boundary so mapped values are aligned for any ``ColumnValue``. The
+     * bitmap trails the values so the writer can stream values without knowing the final size; the header is
+     * written last, so an unfinished file is never mistaken for a valid one.
+     */
+    struct ColumnHeader
+    {
+        static constexpr std::array<char, 8> ExpectedMagic{'M', '2', '4', 'C', 'O', 'L', '\0', '\0'};
+        static constexpr std::uint32_t CurrentVersion = 1;
+        static constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+        std::array<char, 8> magic;
+        std::uint32_t version;
+        std::uint32_t byteOrder;
+        std::uint32_t valueSize;
+        std::uint32_t valueAlignment;
+        std::uint64_t size;
+        std::uint64_t valuesOffset;
+        std::uint64_t bitmapOffset;
+        std::array<std::uint8_t, 16> reserved;
+    };
+
+    static_assert(sizeof(ColumnHeader) == 64 && std::is_trivially_copyable_v<ColumnHeader>);
+
+    constexpr std::uint64_t AlignUp(std::uint64_t value, std::uint64_t alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    inline Result<std::monostate, io::IoError> WriteAll(io::File const& file, std::span<std::byte const> data,
+                                                        std::uint64_t offset)
+    {
+        while (!data.empty())
+        {
+            Result<std::size_t, io::IoError> written = file.WriteAt(data, offset);
+            if (written.IsErr()) return Result<std::monostate, io::IoError>(ErrTag, Unchecked::Err(std::move(written)));
+
+            std::size_t const count = Unchecked::Value(written);
+            data = data.subspan(count);
+            offset += count;
+        }
+
+        return Result<std::monostate, io::IoError>(OkTag, std::monostate());
+    }
+} // namespace internal
+
+/**
+ * Streams a nullable column to disk in the ``internal::ColumnHeader`` format. Values are buffered one chunk at a
+ * time; only the validity bitmap (one bit per element) is held until ``Finish``.
+ */
+template<ColumnValue T>
+class ColumnWriter
+{
+private:
+    using Written = Result<std::monostate, io::IoError>;
+
+    static constexpr std::uint64_t ValuesOffset = sizeof(internal::ColumnHeader);
+
+    io::File _file;
+    std::size_t _chunkSize;
+    std::vector<T> _chunk;
+    ValidityBitmap _validity;
+    std::uint64_t _flushed = 0;
+
+    ColumnWriter(io::File file, std::size_t chunkSize)
+        : _file(std::move(file)),
+          _chunkSize(std::max<std::size_t>(chunkSize, 1))
+    {
+        _chunk.reserve(_chunkSize);
+    }
+
+    Written Flush()
+    {
+        Written written = internal::WriteAll(_file, std::as_bytes(std::span(_chunk)),
+                                             ValuesOffset + _flushed * sizeof(T));
+        if (written.IsErr()) return written;
+
+        _flushed += _chunk.size();
+        _chunk.clear();
+        return written;
+    }
+
+    Written Push(T const& value, bool present)
+    {
+        _chunk.push_back(value);
+        _validity.push_back(present);
+
+        if (_chunk.size() < _chunkSize) return Written(OkTag, std::monostate());
+        return Flush();
+    }
+
+public:
+#pragma region Constructors
+    /**
+     * Creates or truncates ``path``. The header is left zeroed until ``Finish``.
+     *
+     * @param chunkSize Values buffered between writes.
+     */
+    static Result<ColumnWriter, io::IoError> Create(std::string const& path, std::size_t chunkSize = 4096)
+    {
+        using Created = Result<ColumnWriter, io::IoError>;
+
+        Result<io::File, io::IoError> file = io::File::Open(path, O_WRONLY | O_CREAT | O_TRUNC);
+        if (file.IsErr()) return Created(ErrTag, internal::Unchecked::Err(std::move(file)));
+
+        return Created(OkTag, ColumnWriter(internal::Unchecked::Value(std::move(file)), chunkSize));
+    }
+#pragma endregion
+
+#pragma region Append
+    /**
+     * Appends one element; an Err reports a failed flush of the current chunk.
+     */
+    Written Append(Option<T> const& option)
+    {
+        if (option.IsNone()) return AppendNone();
+
+        return Push(internal::Unchecked::Value(option), true);
+    }
+
+    Written Append(T const& value)
+    {
+        return Push(value, true);
+    }
+
+    Written AppendNone()
+    {
+        return Push(T{}, false);
+    }
+#pragma endregion
+
+#pragma region Finish
+    /**
+     * Writes the remaining values, the validity bitmap and finally the header.
+     *
+     * @return The number of elements in the column.
+     */
+    Result<std::uint64_t, io::IoError> Finish()
+    {
+        using Finished = Result<std::uint64_t, io::IoError>;
+
+        Written flushed = Flush();
+        if (flushed.IsErr()) return Finished(ErrTag, internal::Unchecked::Err(std::move(flushed)));
+
+        std::uint64_t const bitmapOffset = internal::AlignUp(ValuesOffset + _flushed * sizeof(T), 8);
+        Written bitmap = internal::WriteAll(_file, std::as_bytes(_validity.Words()), bitmapOffset);
+        if (bitmap.IsErr()) return Finished(ErrTag, internal::Unchecked::Err(std::move(bitmap)));
+
+        internal::ColumnHeader header{};
+        header.magic = internal::ColumnHeader::ExpectedMagic;
+        header.version = internal::ColumnHeader::CurrentVersion;
+        header.byteOrder = internal::ColumnHeader::ByteOrderMark;
+        header.valueSize = sizeof(T);
+        header.valueAlignment = alignof(T);
+        header.size = _flushed;
+        header.valuesOffset = ValuesOffset;
+        header.bitmapOffset = bitmapOffset;
+
+        Written written = internal::WriteAll(_file, std::as_bytes(std::span(&header, 1)), 0);
+        if (written.IsErr()) return Finished(ErrTag, internal::Unchecked::Err(std::move(written)));
+
+        return Finished(OkTag, _flushed);
+    }
+#pragma endregion
+};
+
+/**
+ * Read-only, zero-copy view of a column file. Pages are faulted in lazily on first touch; element access hands
+ * out ``OptionRef``s pointing straight into the mapping.
+ */
+template<ColumnValue T>
+class MappedColumn
+{
+private:
+    void* _mapping = nullptr;
+    std::size_t _mappingSize = 0;
+    T const* _values = nullptr;
+    ValidityBitmap::Word const* _words = nullptr;
+    std::size_t _size = 0;
+
+    MappedColumn() = default;
+
+    static int Advice(ColumnAccess access) noexcept
+    {
+        switch (access)
+        {
+        case ColumnAccess::Sequential: return MADV_SEQUENTIAL;
+        case ColumnAccess::Random: return MADV_RANDOM;
+        case ColumnAccess::WillNeed: return MADV_WILLNEED;
+        case ColumnAccess::Normal: break;
+        }
+
+        return MADV_NORMAL;
+    }
+
+    static Option<ColumnFormatError> Validate(internal::ColumnHeader const& header, std::size_t fileSize)
+    {
+        if (header.magic != internal::ColumnHeader::ExpectedMagic) return Prelude::Some(ColumnFormatError::BadMagic);
+        if (header.version != internal::ColumnHeader::CurrentVersion)
+            return Prelude::Some(ColumnFormatError::UnsupportedVersion);
+        if (header.byteOrder != internal::ColumnHeader::ByteOrderMark || header.valueSize != sizeof(T) ||
+            header.valueAlignment != alignof(T))
+            return Prelude::Some(ColumnFormatError::TypeMismatch);
+
+        // Every bound is checked by subtraction from a value already known to fit, so a hostile header cannot
+        // wrap a sum around and pass.
+        auto const truncated = Prelude::Some(ColumnFormatError::Truncated);
+        if (header.valuesOffset % 64 != 0 || header.bitmapOffset % 8 != 0) return truncated;
+        if (header.bitmapOffset > fileSize || header.valuesOffset > header.bitmapOffset) return truncated;
+        if (header.size > (header.bitmapOffset - header.valuesOffset) / sizeof(T)) return truncated;
+
+        std::uint64_t const words = ValidityBitmap::WordCount(header.size);
+        if (words > (fileSize - header.bitmapOffset) / sizeof(ValidityBitmap::Word)) return truncated;
+
+        return Prelude::None;
+    }
+
+public:
+#pragma region Constructors
+    /**
+     * Maps ``path`` read-only and applies ``access`` as an ``madvise`` hint. Nothing is read beyond the header.
+     */
+    static Result<MappedColumn, ColumnError> Open(std::string const& path, ColumnAccess access = ColumnAccess::Normal)
+    {
+        using Opened = Result<MappedColumn, ColumnError>;
+
+        Result<io::File, io::IoError> opened = io::File::Open(path);
+        if (opened.IsErr()) return Opened(ErrTag, ColumnError(internal::Unchecked::Err(std::move(opened))));
+        io::File const file = internal::Unchecked::Value(std::move(opened));
+
+        struct stat status{};
+        if (::fstat(file.Native(), &status) != 0) return Opened(ErrTag, ColumnError(io::IoError::Last()));
+
+        std::size_t const fileSize = static_cast<std::size_t>(status.st_size);
+        if (fileSize < sizeof(internal::ColumnHeader)) return Opened(ErrTag, ColumnError(ColumnFormatError::Truncated));
+
+        MappedColumn column;
+        column._mapping = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, file.Native(), 0);
+        if (column._mapping == MAP_FAILED)
+        {
+            column._mapping = nullptr;
+            return Opened(ErrTag, ColumnError(io::IoError::Last()));
+        }
+        column._mappingSize = fileSize;
+
+        internal::ColumnHeader header;
+        std::memcpy(&header, column._mapping, sizeof(header));
+
+        Option<ColumnFormatError> invalid = Validate(header, fileSize);
+        if (invalid.IsSome()) return Opened(ErrTag, ColumnError(internal::Unchecked::Value(invalid)));
+
+        auto const* base = static_cast<std::byte const*>(column._mapping);
+        column._values = reinterpret_cast<T const*>(base + header.valuesOffset);
+        column._words = reinterpret_cast<ValidityBitmap::Word const*>(base + header.bitmapOffset);
+        column._size = header.size;
+
+        ::madvise(column._mapping, fileSize, Advice(access));
+        return Opened(OkTag, std::move(column));
+    }
+
+    MappedColumn(MappedColumn&& other) noexcept
+        : _mapping(std::exchange(other._mapping, nullptr)),
+          _mappingSize(std::exchange(other._mappingSize, 0)),
+          _values(std::exchange(other._values, nullptr)),
+          _words(std::exchange(other._words, nullptr)),
+          _size(std::exchange(other._size, 0))
+    {
+    }
+
+    MappedColumn& operator=(MappedColumn&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_mapping != nullptr) ::munmap(_mapping, _mappingSize);
+            _mapping = std::exchange(other._mapping, nullptr);
+            _mappingSize = std::exchange(other._mappingSize, 0);
+            _values = std::exchange(other._values, nullptr);
+            _words = std::exchange(other._words, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+
+        return *this;
+    }
+
+    ~MappedColumn()
+    {
+        if (_mapping != nullptr) ::munmap(_mapping, _mappingSize);
+    }
+#pragma endregion
+
+#pragma region Access
+    /**
+     * @return The element at ``index``, referencing the mapped value; ``index`` must be below ``size()``.
+     */
+    OptionRef<T const> operator[](std::size_t index) const noexcept
+    {
+        return OptionRef<T const>::FromPointer(IsSome(index) ? _values + index : nullptr);
+    }
+
+    [[nodiscard]] bool IsSome(std::size_t index) const noexcept
+    {
+        return (_words[index / ValidityBitmap::WordBits] >> (index % ValidityBitmap::WordBits)) & 1;
+    }
+
+    /**
+     * @return The raw value column, None slots included (they read as zero bytes).
+     */
+    [[nodiscard]] std::span<T const> Values() const noexcept
+    {
+        return std::span(_values, _size);
+    }
+
+    [[nodiscard]] std::span<ValidityBitmap::Word const> Validity() const noexcept
+    {
+        return std::span(_words, ValidityBitmap::WordCount(_size));
+    }
+#pragma endregion
+
+#pragma region Capacity
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @return Number of Some elements, counted a bitmap word at a time.
+     */
+    [[nodiscard]] std::size_t Count() const noexcept
+    {
+        std::size_t count = 0;
+        for (ValidityBitmap::Word const word : Validity()) count += std::popcount(word);
+        return count;
+    }
+#pragma endregion
+
+#pragma region ForEachSome
+    /**
+     * Calls ``action(index, value)`` for every Some element, skipping empty bitmap words whole.
+     */
+    template<typename Action>
+    void ForEachSome(Action&& action) const
+    {
+        std::span<ValidityBitmap::Word const> const words = Validity();
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+            for (ValidityBitmap::Word word = words[w]; word != 0; word &= word - 1)
+            {
+                std::size_t const index = w * ValidityBitmap::WordBits + std::countr_zero(word);
+                action(index, _values[index]);
+            }
+        }
+    }
+#pragma endregion
+
+#pragma region Iter
+    struct Iterator
+    {
+        MappedColumn const* column = nullptr;
+        std::size_t index = 0;
+
+        using value_type = OptionRef<T const>;
+        using difference_type = std::ptrdiff_t;
+
+        value_type operator*() const noexcept
+        {
+            return (*column)[index];
+        }
+
+        Iterator& operator++() noexcept
+        {
+            ++index;
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator result = *this;
+            ++index;
+            return result;
+        }
+
+        bool operator==(Iterator const& other) const noexcept
+        {
+            return index == other.index;
+        }
+    };
+
+    Iterator begin() const noexcept
+    {
+        return Iterator{this, 0};
+    }
+
+    Iterator end() const noexcept
+    {
+        return Iterator{this, _size};
+    }
+#pragma endregion
+
+#pragma region Prefetch
+    /**
+     * Asks the kernel to read in the pages backing elements ``[first, first + count)`` ahead of use.
+     */
+    void Prefetch(std::size_t first, std::size_t count) const noexcept
+    {
+        if (first >= _size) return;
+        count = std::min(count, _size - first);
+
+        std::uintptr_t const page = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+        auto const begin = reinterpret_cast<std::uintptr_t>(_values + first) / page * page;
+        auto const end = reinterpret_cast<std::uintptr_t>(_values + first + count);
+
+        ::madvise(reinterpret_cast<void*>(begin), end - begin, MADV_WILLNEED);
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // COLUMN_FILE_H
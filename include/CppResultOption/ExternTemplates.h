@@ -0,0 +1,32 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+// Included at the end of both Option.h and Result.h, which include each other: only the second of the two
+// inclusions sees both class templates complete, so the guard is checked together with that condition.
+#if defined(M24_EXTERN_TEMPLATES) && defined(M24_OPTION_COMPLETE) && defined(M24_RESULT_COMPLETE) &&                  \
+    !defined(EXTERN_TEMPLATES_H)
+#define EXTERN_TEMPLATES_H
+
+#include "Instantiations.h"
+
+namespace m24
+{
+
+#define M24_EXTERN_OPTION(T)                                                                                           \
+    extern template class internal::OptionBase<T>;                                                                     \
+    extern template class Option<T>;
+
+#define M24_EXTERN_RESULT(T, E)                                                                                        \
+    extern template class internal::ResultBase<T, E>;                                                                  \
+    extern template class Result<T, E>;
+
+M24_OPTION_INSTANTIATIONS(M24_EXTERN_OPTION)
+M24_RESULT_INSTANTIATIONS(M24_EXTERN_RESULT)
+
+#undef M24_EXTERN_RESULT
+#undef M24_EXTERN_OPTION
+
+} // namespace m24
+
+#endif // EXTERN_TEMPLATES_H
@@ -0,0 +1,398 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef FOLD_H
+#define FOLD_H
+
+#include "NullableKernels.h"
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "OptionVector.h"
+#include "OverflowError.h"
+#include "Result.h"
+#include "ResultPrelude.h"
+#include "Unchecked.h"
+
+#include <functional>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace m24
+{
+
+namespace internal
+{
+    template<typename Range>
+    using ResultValueOf = typename ResultTraits<std::ranges::range_value_t<Range>>::ValueType;
+
+    template<typename Range>
+    using ResultErrorOf = typename ResultTraits<std::ranges::range_value_t<Range>>::ErrorType;
+
+    template<typename Range>
+    using OptionValueOf = typename OptionTraits<std::ranges::range_value_t<Range>>::ValueType;
+
+    /**
+     * @return true if ``lhs + rhs`` overflowed; ``out`` holds the result otherwise.
+     */
+    template<typename T>
+    bool AddOverflows(T lhs, T rhs, T& out) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_add_overflow(lhs, rhs, &out);
+#else
+        if (rhs > 0 ? lhs > std::numeric_limits<T>::max() - rhs : lhs < std::numeric_limits<T>::min() - rhs)
+            return true;
+        out = static_cast<T>(lhs + rhs);
+        return false;
+#endif
+    }
+
+    /**
+     * @return true if ``lhs * rhs`` overflowed; ``out`` holds the result otherwise.
+     */
+    template<typename T>
+    bool MulOverflows(T lhs, T rhs, T& out) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_mul_overflow(lhs, rhs, &out);
+#else
+        if (lhs != 0 && rhs != 0)
+        {
+            if constexpr (std::is_signed_v<T>)
+            {
+                if ((lhs == -1 && rhs == std::numeric_limits<T>::min()) ||
+                    (rhs == -1 && lhs == std::numeric_limits<T>::min()))
+                    return true;
+            }
+            T const product = static_cast<T>(lhs * rhs);
+            if (product / rhs != lhs) return true;
+        }
+        out = static_cast<T>(lhs * rhs);
+        return false;
+#endif
+    }
+} // namespace internal
+
+#pragma region TryFold
+/**
+ * Folds the Ok values of ``results`` with ``functor(acc, value)``, stopping at the first Err.
+ * ``functor`` may return the new accumulator directly or as a ``Result<Acc, E>`` to fail the fold itself.
+ */
+template<std::ranges::input_range Range, typename Acc, typename Functor>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+Result<Acc, internal::ResultErrorOf<Range>> TryFold(Range&& results, Acc init, Functor&& functor)
+{
+    using E = internal::ResultErrorOf<Range>;
+
+    for (auto&& result : results)
+    {
+        if (result.IsErr()) return Result<Acc, E>(ErrTag, internal::ForwardErr<Range>(result));
+
+        auto&& next = functor(std::move(init), internal::ForwardValue<Range>(result));
+        if constexpr (internal::ResultLike<decltype(next)>)
+        {
+            if (next.IsErr()) return Result<Acc, E>(ErrTag, internal::Unchecked::Err(std::move(next)));
+            init = internal::Unchecked::Value(std::move(next));
+        }
+        else
+        {
+            init = std::move(next);
+        }
+    }
+
+    return Result<Acc, E>(OkTag, std::move(init));
+}
+
+/**
+ * Folds the Some values of ``options`` with ``functor(acc, value)``, stopping at the first None.
+ * ``functor`` may return the new accumulator directly or as an ``Option<Acc>`` to end the fold with None.
+ */
+template<std::ranges::input_range Range, typename Acc, typename Functor>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+Option<Acc> TryFold(Range&& options, Acc init, Functor&& functor)
+{
+    for (auto&& option : options)
+    {
+        if (option.IsNone()) return Prelude::None;
+
+        auto&& next = functor(std::move(init), internal::ForwardValue<Range>(option));
+        if constexpr (internal::OptionLike<decltype(next)>)
+        {
+            if (next.IsNone()) return Prelude::None;
+            init = internal::Unchecked::Value(std::move(next));
+        }
+        else
+        {
+            init = std::move(next);
+        }
+    }
+
+    return Option<Acc>(std::move(init));
+}
+#pragma endregion
+
+#pragma region Sum / Product
+/**
+ * ``Ok(sum)`` of all values, or the first Err.
+ */
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+auto Sum(Range&& results)
+{
+    using T = internal::ResultValueOf<Range>;
+    return TryFold(std::forward<Range>(results), T{}, [](T acc, T const& value) { return static_cast<T>(acc + value); });
+}
+
+/**
+ * ``Some(sum)`` of all values, or None if any element is None.
+ */
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+auto Sum(Range&& options)
+{
+    using T = internal::OptionValueOf<Range>;
+    return TryFold(std::forward<Range>(options), T{}, [](T acc, T const& value) { return static_cast<T>(acc + value); });
+}
+
+/**
+ * Columnar overload: one popcount decides the None case, then the value column is summed by the vectorized kernel.
+ */
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+Option<T> Sum(OptionVector<T> const& column)
+{
+    if (column.CountNone() != 0) return Prelude::None;
+
+    return Option<T>(Kernels::Sum(column));
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+auto Product(Range&& results)
+{
+    using T = internal::ResultValueOf<Range>;
+    return TryFold(std::forward<Range>(results), T{1}, [](T acc, T const& value) { return static_cast<T>(acc * value); });
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+auto Product(Range&& options)
+{
+    using T = internal::OptionValueOf<Range>;
+    return TryFold(std::forward<Range>(options), T{1}, [](T acc, T const& value) { return static_cast<T>(acc * value); });
+}
+#pragma endregion
+
+#pragma region CheckedSum / CheckedProduct
+/**
+ * Like ``Sum`` but fails with ``E(OverflowError())`` instead of wrapping on integer overflow.
+ */
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>> &&
+             std::is_integral_v<internal::ResultValueOf<Range>> &&
+             std::is_constructible_v<internal::ResultErrorOf<Range>, OverflowError>)
+auto CheckedSum(Range&& results)
+{
+    using T = internal::ResultValueOf<Range>;
+    using E = internal::ResultErrorOf<Range>;
+
+    return TryFold(std::forward<Range>(results), T{},
+                   [](T acc, T const& value)
+                   {
+                       T sum;
+                       if (internal::AddOverflows(acc, value, sum)) return Result<T, E>(ErrTag, E(OverflowError()));
+                       return Result<T, E>(OkTag, sum);
+                   });
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>> &&
+             std::is_integral_v<internal::ResultValueOf<Range>> &&
+             std::is_constructible_v<internal::ResultErrorOf<Range>, OverflowError>)
+auto CheckedProduct(Range&& results)
+{
+    using T = internal::ResultValueOf<Range>;
+    using E = internal::ResultErrorOf<Range>;
+
+    return TryFold(std::forward<Range>(results), T{1},
+                   [](T acc, T const& value)
+                   {
+                       T product;
+                       if (internal::MulOverflows(acc, value, product)) return Result<T, E>(ErrTag, E(OverflowError()));
+                       return Result<T, E>(OkTag, product);
+                   });
+}
+
+/**
+ * ``Ok(Some(sum))``, ``Ok(None)`` if any element is None, or ``Err`` on integer overflow.
+ */
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>> &&
+             std::is_integral_v<internal::OptionValueOf<Range>>)
+Result<Option<internal::OptionValueOf<Range>>, OverflowError> CheckedSum(Range&& options)
+{
+    using T = internal::OptionValueOf<Range>;
+
+    T sum{};
+    for (auto const& option : options)
+    {
+        if (option.IsNone()) return Result<Option<T>, OverflowError>(OkTag, Option<T>());
+        if (internal::AddOverflows(sum, internal::Unchecked::Value(option), sum))
+            return Result<Option<T>, OverflowError>(ErrTag, OverflowError());
+    }
+
+    return Result<Option<T>, OverflowError>(OkTag, Option<T>(sum));
+}
+#pragma endregion
+
+#pragma region Min / Max
+/**
+ * ``Ok(Some(min))``, ``Ok(None)`` for an empty range, or the first Err.
+ */
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+auto Min(Range&& results)
+{
+    using T = internal::ResultValueOf<Range>;
+    using E = internal::ResultErrorOf<Range>;
+
+    std::optional<T> min;
+    for (auto const& result : results)
+    {
+        if (result.IsErr()) return Result<Option<T>, E>(ErrTag, internal::Unchecked::Err(result));
+
+        T const& value = internal::Unchecked::Value(result);
+        if (!min || value < *min) min = value;
+    }
+
+    if (!min) return Result<Option<T>, E>(OkTag, Option<T>());
+    return Result<Option<T>, E>(OkTag, Option<T>(*min));
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+auto Max(Range&& results)
+{
+    using T = internal::ResultValueOf<Range>;
+    using E = internal::ResultErrorOf<Range>;
+
+    std::optional<T> max;
+    for (auto const& result : results)
+    {
+        if (result.IsErr()) return Result<Option<T>, E>(ErrTag, internal::Unchecked::Err(result));
+
+        T const& value = internal::Unchecked::Value(result);
+        if (!max || *max < value) max = value;
+    }
+
+    if (!max) return Result<Option<T>, E>(OkTag, Option<T>());
+    return Result<Option<T>, E>(OkTag, Option<T>(*max));
+}
+
+/**
+ * ``Some(min)`` of all values, or None if the range is empty or any element is None.
+ */
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+auto Min(Range&& options)
+{
+    using T = internal::OptionValueOf<Range>;
+
+    std::optional<T> min;
+    for (auto const& option : options)
+    {
+        if (option.IsNone()) return Option<T>();
+
+        T const& value = internal::Unchecked::Value(option);
+        if (!min || value < *min) min = value;
+    }
+
+    if (!min) return Option<T>();
+    return Option<T>(*min);
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+auto Max(Range&& options)
+{
+    using T = internal::OptionValueOf<Range>;
+
+    std::optional<T> max;
+    for (auto const& option : options)
+    {
+        if (option.IsNone()) return Option<T>();
+
+        T const& value = internal::Unchecked::Value(option);
+        if (!max || *max < value) max = value;
+    }
+
+    if (!max) return Option<T>();
+    return Option<T>(*max);
+}
+
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+Option<T> Min(OptionVector<T> const& column)
+{
+    if (column.CountNone() != 0) return Prelude::None;
+
+    return Kernels::Min(column);
+}
+
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+Option<T> Max(OptionVector<T> const& column)
+{
+    if (column.CountNone() != 0) return Prelude::None;
+
+    return Kernels::Max(column);
+}
+#pragma endregion
+
+#pragma region AllOk / AnyErr
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+bool AllOk(Range&& results)
+{
+    for (auto const& result : results)
+    {
+        if (result.IsErr()) return false;
+    }
+
+    return true;
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::ResultLike<std::ranges::range_value_t<Range>>)
+bool AnyErr(Range&& results)
+{
+    return !AllOk(std::forward<Range>(results));
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+bool AllSome(Range&& options)
+{
+    for (auto const& option : options)
+    {
+        if (option.IsNone()) return false;
+    }
+
+    return true;
+}
+
+template<std::ranges::input_range Range>
+    requires(internal::OptionLike<std::ranges::range_value_t<Range>>)
+bool AnyNone(Range&& options)
+{
+    return !AllSome(std::forward<Range>(options));
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // FOLD_H
@@ -0,0 +1,424 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "Result.h"
+#include "Unchecked.h"
+
+#include <array>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace m24
+{
+
+namespace internal
+{
+    /**
+     * Per-thread free lists of coroutine frames, bucketed by size in 64-byte steps up to 1 KiB. Frames freed on
+     * another thread join that thread's lists; larger frames and overflow go straight to the global allocator.
+     */
+    class FramePool
+    {
+    private:
+        static constexpr std::size_t Granularity = 64;
+        static constexpr std::size_t ClassCount = 16;
+        static constexpr std::size_t MaxCachedPerClass = 64;
+
+        struct Node
+        {
+            Node* next;
+        };
+
+        struct Cache
+        {
+            std::array<Node*, ClassCount> heads{};
+            std::array<std::size_t, ClassCount> counts{};
+
+            ~Cache()
+            {
+                for (Node* head : heads)
+                    while (head != nullptr) ::operator delete(std::exchange(head, head->next));
+            }
+        };
+
+        static Cache& Local() noexcept
+        {
+            thread_local Cache cache;
+            return cache;
+        }
+
+        static constexpr std::size_t ClassOf(std::size_t size) noexcept
+        {
+            return (size + Granularity - 1) / Granularity - 1;
+        }
+
+    public:
+        static void* Allocate(std::size_t size)
+        {
+            std::size_t const sizeClass = ClassOf(size);
+            if (sizeClass >= ClassCount) return ::operator new(size);
+
+            Cache& cache = Local();
+            if (Node* node = cache.heads[sizeClass]; node != nullptr)
+            {
+                cache.heads[sizeClass] = node->next;
+                --cache.counts[sizeClass];
+                return node;
+            }
+
+            return ::operator new((sizeClass + 1) * Granularity);
+        }
+
+        static void Deallocate(void* pointer, std::size_t size) noexcept
+        {
+            std::size_t const sizeClass = ClassOf(size);
+            if (sizeClass >= ClassCount)
+            {
+                ::operator delete(pointer);
+                return;
+            }
+
+            Cache& cache = Local();
+            if (cache.counts[sizeClass] == MaxCachedPerClass)
+            {
+                ::operator delete(pointer);
+                return;
+            }
+
+            cache.heads[sizeClass] = ::new (pointer) Node{cache.heads[sizeClass]};
+            ++cache.counts[sizeClass];
+        }
+
+        /**
+         * @return Number of frames cached on the calling thread.
+         */
+        static std::size_t Cached() noexcept
+        {
+            std::size_t total = 0;
+            for (std::size_t count : Local().counts) total += count;
+            return total;
+        }
+    };
+
+    /**
+     * Base for promise types whose coroutine frames come from ``FramePool``.
+     */
+    struct PooledFrame
+    {
+        static void* operator new(std::size_t size)
+        {
+            return FramePool::Allocate(size);
+        }
+
+        static void operator delete(void* pointer, std::size_t size) noexcept
+        {
+            FramePool::Deallocate(pointer, size);
+        }
+    };
+
+    /**
+     * Promise state shared by ``Generator`` and ``TryGenerator``. A yielded rvalue is referenced in place (it lives
+     * until the coroutine resumes) and moved out once by ``Next``; a yielded lvalue is copied into the promise first.
+     */
+    template<typename T>
+    class GeneratorPromiseBase : public PooledFrame
+    {
+    private:
+        T* _current = nullptr;
+        Option<T> _copy;
+        std::exception_ptr _exception;
+
+    public:
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_always yield_value(T&& value) noexcept
+        {
+            _current = std::addressof(value);
+            return {};
+        }
+
+        std::suspend_always yield_value(T const& value)
+        {
+            _current = std::addressof(Unchecked::Emplace(_copy, value));
+            return {};
+        }
+
+        void unhandled_exception() noexcept
+        {
+            _exception = std::current_exception();
+        }
+
+        void RethrowIfFailed() const
+        {
+            if (_exception) std::rethrow_exception(_exception);
+        }
+
+        T&& Current() noexcept
+        {
+            return std::move(*_current);
+        }
+    };
+
+    /**
+     * Owns a suspended coroutine and resumes it one step at a time.
+     */
+    template<typename Promise>
+    class GeneratorHandle
+    {
+    private:
+        std::coroutine_handle<Promise> _handle;
+
+    public:
+        explicit GeneratorHandle(std::coroutine_handle<Promise> handle) noexcept
+            : _handle(handle)
+        {
+        }
+
+        GeneratorHandle(GeneratorHandle&& other) noexcept
+            : _handle(std::exchange(other._handle, nullptr))
+        {
+        }
+
+        GeneratorHandle& operator=(GeneratorHandle&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (_handle) _handle.destroy();
+                _handle = std::exchange(other._handle, nullptr);
+            }
+
+            return *this;
+        }
+
+        ~GeneratorHandle()
+        {
+            if (_handle) _handle.destroy();
+        }
+
+        /**
+         * Runs the coroutine to its next ``co_yield`` or to its end.
+         *
+         * @return The promise if a value was yielded, ``nullptr`` once the coroutine has finished.
+         */
+        Promise* Advance()
+        {
+            if (!_handle || _handle.done()) return nullptr;
+
+            _handle.resume();
+            _handle.promise().RethrowIfFailed();
+
+            return _handle.done() ? nullptr : &_handle.promise();
+        }
+
+        void Finish() noexcept
+        {
+            if (_handle) _handle.destroy();
+            _handle = nullptr;
+        }
+    };
+
+    /**
+     * Single-pass iterator over anything with ``Next()`` returning ``Option<T>``.
+     */
+    template<typename Source, typename T>
+    class NextIterator
+    {
+    private:
+        Source* _source = nullptr;
+        mutable Option<T> _current;
+
+    public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        NextIterator() = default;
+
+        explicit NextIterator(Source& source)
+            : _source(&source),
+              _current(source.Next())
+        {
+        }
+
+        T& operator*() const noexcept
+        {
+            return Unchecked::Value(_current);
+        }
+
+        NextIterator& operator++()
+        {
+            Option<T> next = _source->Next();
+            if (next.IsSome())
+                Unchecked::Emplace(_current, Unchecked::Value(std::move(next)));
+            else
+                _current = Option<T>();
+
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return _current.IsNone();
+        }
+    };
+} // namespace internal
+
+/**
+ * Coroutine generator: ``co_yield`` values, read them with ``Next()``, which returns None once the coroutine ends.
+ * Frames come from a per-thread pool, so short-lived generators do not reach ``malloc`` in steady state.
+ * An exception escaping the coroutine is rethrown from ``Next``.
+ */
+template<typename T>
+class Generator
+{
+public:
+    struct promise_type : internal::GeneratorPromiseBase<T>
+    {
+        Generator get_return_object() noexcept
+        {
+            return Generator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        void return_void() const noexcept
+        {
+        }
+    };
+
+private:
+    internal::GeneratorHandle<promise_type> _handle;
+
+    explicit Generator(std::coroutine_handle<promise_type> handle) noexcept
+        : _handle(handle)
+    {
+    }
+
+public:
+    Generator(Generator&&) noexcept = default;
+    Generator& operator=(Generator&&) noexcept = default;
+
+#pragma region Next
+    /**
+     * @return The next yielded value, moved out, or None at the end of the stream.
+     */
+    Option<T> Next()
+    {
+        promise_type* promise = _handle.Advance();
+        if (promise == nullptr) return Prelude::None;
+
+        return Option<T>(promise->Current());
+    }
+#pragma endregion
+
+#pragma region Iter
+    auto begin()
+    {
+        return internal::NextIterator<Generator, T>(*this);
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+#pragma endregion
+};
+
+/**
+ * Generator whose stream can end in an error: ``co_yield`` values, or ``co_yield`` an Err to stop with it.
+ * ``Next()`` returns ``Ok(Some(value))`` per value, ``Ok(None)`` at the end, or the terminal ``Err`` once.
+ */
+template<typename T, typename E = std::runtime_error>
+class TryGenerator
+{
+public:
+    struct promise_type : internal::GeneratorPromiseBase<Result<T, E>>
+    {
+        using Base = internal::GeneratorPromiseBase<Result<T, E>>;
+        using Base::yield_value;
+
+        Option<T> value;
+
+        TryGenerator get_return_object() noexcept
+        {
+            return TryGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        std::suspend_always yield_value(T&& yielded) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            internal::Unchecked::Emplace(value, std::move(yielded));
+            return {};
+        }
+
+        std::suspend_always yield_value(T const& yielded)
+        {
+            internal::Unchecked::Emplace(value, yielded);
+            return {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+    };
+
+private:
+    internal::GeneratorHandle<promise_type> _handle;
+
+    explicit TryGenerator(std::coroutine_handle<promise_type> handle) noexcept
+        : _handle(handle)
+    {
+    }
+
+public:
+    TryGenerator(TryGenerator&&) noexcept = default;
+    TryGenerator& operator=(TryGenerator&&) noexcept = default;
+
+#pragma region Next
+    Result<Option<T>, E> Next()
+    {
+        promise_type* promise = _handle.Advance();
+        if (promise == nullptr) return Result<Option<T>, E>(OkTag, Option<T>());
+
+        if (promise->value.IsSome())
+        {
+            Result<Option<T>, E> result(OkTag, Option<T>(internal::Unchecked::Value(std::move(promise->value))));
+            promise->value = Option<T>();
+            return result;
+        }
+
+        Result<T, E>&& yielded = promise->Current();
+        if (yielded.IsOk())
+            return Result<Option<T>, E>(OkTag, Option<T>(internal::Unchecked::Value(std::move(yielded))));
+
+        Result<Option<T>, E> error(ErrTag, internal::Unchecked::Err(std::move(yielded)));
+        _handle.Finish();
+        return error;
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // GENERATOR_H
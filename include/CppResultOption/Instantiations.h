@@ -0,0 +1,36 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef INSTANTIATIONS_H
+#define INSTANTIATIONS_H
+
+#include <stdexcept>
+#include <string>
+
+#ifdef M24_INSTANTIATIONS_HEADER
+#include M24_INSTANTIATIONS_HEADER
+#endif
+
+/**
+ * Specializations compiled once into the ``CppResultOption`` library and declared ``extern template`` everywhere
+ * else. Override either list by defining the macro in ``M24_INSTANTIATIONS_HEADER``; types containing commas need
+ * an alias. Each type must instantiate completely, so e.g. ``Option<bool>`` is not eligible.
+ */
+#ifndef M24_OPTION_INSTANTIATIONS
+#define M24_OPTION_INSTANTIATIONS(X)                                                                                   \
+    X(int)                                                                                                             \
+    X(long long)                                                                                                       \
+    X(double)                                                                                                          \
+    X(std::string)
+#endif
+
+#ifndef M24_RESULT_INSTANTIATIONS
+#define M24_RESULT_INSTANTIATIONS(X)                                                                                   \
+    X(int, std::string)                                                                                                \
+    X(int, std::runtime_error)                                                                                         \
+    X(std::string, std::string)                                                                                        \
+    X(std::string, std::runtime_error)
+#endif
+
+#endif // INSTANTIATIONS_H
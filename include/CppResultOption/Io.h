@@ -0,0 +1,731 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef IO_H
+#define IO_H
+
+#include "IoError.h"
+#include "Result.h"
+#include "ThreadPool.h"
+#include "Unchecked.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define M24_IO_URING 1
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace m24::io
+{
+
+using Completion = Result<std::size_t, IoError>;
+using CompletionHandler = std::move_only_function<void(Completion&&)>;
+
+enum class RingBackend
+{
+    /// io_uring when the kernel allows it, otherwise ``ThreadPool``.
+    Auto,
+    IoUring,
+    /// Blocking ``pread``/``pwrite`` on a small dedicated thread pool.
+    ThreadPool,
+};
+
+namespace internal
+{
+    inline Completion ReadAt(int fd, std::span<std::byte> buffer, std::uint64_t offset)
+    {
+        ssize_t read;
+        do read = ::pread(fd, buffer.data(), buffer.size(), static_cast<off_t>(offset));
+        while (read < 0 && errno == EINTR);
+
+        if (read < 0) return Completion(ErrTag, IoError::Last());
+        return Completion(OkTag, static_cast<std::size_t>(read));
+    }
+
+    inline Completion WriteAt(int fd, std::span<std::byte const> data, std::uint64_t offset)
+    {
+        ssize_t written;
+        do written = ::pwrite(fd, data.data(), data.size(), static_cast<off_t>(offset));
+        while (written < 0 && errno == EINTR);
+
+        if (written < 0) return Completion(ErrTag, IoError::Last());
+        return Completion(OkTag, static_cast<std::size_t>(written));
+    }
+} // namespace internal
+
+/**
+ * Owning file descriptor with positional, errno-free reads and writes.
+ */
+class File
+{
+private:
+    int _fd = -1;
+
+public:
+#pragma region Constructors
+    File() = default;
+
+    explicit File(int fd) noexcept
+        : _fd(fd)
+    {
+    }
+
+    File(File&& other) noexcept
+        : _fd(std::exchange(other._fd, -1))
+    {
+    }
+
+    File& operator=(File&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (_fd >= 0) ::close(_fd);
+            _fd = std::exchange(other._fd, -1);
+        }
+
+        return *this;
+    }
+
+    ~File()
+    {
+        if (_fd >= 0) ::close(_fd);
+    }
+
+    /**
+     * ``open(2)`` with ``O_CLOEXEC`` added.
+     */
+    static Result<File, IoError> Open(std::string const& path, int flags = O_RDONLY, mode_t mode = 0644)
+    {
+        int const fd = ::open(path.c_str(), flags | O_CLOEXEC, mode);
+        if (fd < 0) return Result<File, IoError>(ErrTag, IoError::Last());
+
+        return Result<File, IoError>(OkTag, File(fd));
+    }
+#pragma endregion
+
+#pragma region Native
+    [[nodiscard]] int Native() const noexcept
+    {
+        return _fd;
+    }
+#pragma endregion
+
+#pragma region ReadAt
+    /**
+     * One ``pread``; like it, may return fewer bytes than requested, and 0 at end of file.
+     */
+    Result<std::size_t, IoError> ReadAt(std::span<std::byte> buffer, std::uint64_t offset) const
+    {
+        return internal::ReadAt(_fd, buffer, offset);
+    }
+#pragma endregion
+
+#pragma region WriteAt
+    /**
+     * One ``pwrite``; like it, may write fewer bytes than given.
+     */
+    Result<std::size_t, IoError> WriteAt(std::span<std::byte const> data, std::uint64_t offset) const
+    {
+        return internal::WriteAt(_fd, data, offset);
+    }
+#pragma endregion
+};
+
+namespace internal
+{
+    enum class IoOpKind : std::uint8_t
+    {
+        Read,
+        Write,
+        ReadFixed,
+        WriteFixed,
+    };
+
+    struct IoOp
+    {
+        IoOpKind kind;
+        int fd;
+        void* data;
+        std::uint32_t length;
+        std::uint16_t bufferIndex;
+        std::uint64_t offset;
+        std::uint64_t id;
+    };
+
+    struct IoCompletion
+    {
+        std::uint64_t id;
+        Completion result;
+    };
+
+    /**
+     * Executes ``op`` with a blocking syscall; for fixed-buffer ops ``data`` already points at the buffer.
+     */
+    inline Completion ExecuteBlocking(IoOp const& op)
+    {
+        if (op.kind == IoOpKind::Read || op.kind == IoOpKind::ReadFixed)
+            return ReadAt(op.fd, std::span(static_cast<std::byte*>(op.data), op.length), op.offset);
+
+        return WriteAt(op.fd, std::span(static_cast<std::byte const*>(op.data), op.length), op.offset);
+    }
+
+    /**
+     * Runs queued ops on dedicated threads. Submission hands the whole batch over at once; results queue up until
+     * the ring reaps them, so handlers still run on the thread that waits, as with io_uring.
+     */
+    class PoolIoBackend
+    {
+    private:
+        std::vector<IoOp> _queued;
+        std::mutex _mutex;
+        std::condition_variable _ready;
+        std::vector<IoCompletion> _completed;
+        // Declared last: its destructor finishes outstanding ops while the members above are still alive.
+        ThreadPool _workers;
+
+    public:
+        explicit PoolIoBackend(std::size_t threads)
+            : _workers(threads)
+        {
+        }
+
+        void Queue(IoOp const& op)
+        {
+            _queued.push_back(op);
+        }
+
+        Result<std::size_t, IoError> Submit(std::size_t waitFor)
+        {
+            std::size_t const submitted = _queued.size();
+            for (IoOp const& op : _queued)
+            {
+                _workers.Post(
+                    [this, op]
+                    {
+                        Completion result = ExecuteBlocking(op);
+                        {
+                            std::lock_guard lock(_mutex);
+                            _completed.push_back(IoCompletion{op.id, std::move(result)});
+                        }
+                        _ready.notify_all();
+                    });
+            }
+            _queued.clear();
+
+            if (waitFor > 0)
+            {
+                std::unique_lock lock(_mutex);
+                _ready.wait(lock, [&] { return _completed.size() >= waitFor; });
+            }
+
+            return Completion(OkTag, submitted);
+        }
+
+        void Reap(std::vector<IoCompletion>& out)
+        {
+            std::lock_guard lock(_mutex);
+            for (IoCompletion& completion : _completed) out.push_back(std::move(completion));
+            _completed.clear();
+        }
+    };
+
+#ifdef M24_IO_URING
+    /**
+     * Minimal io_uring driver over the raw syscalls: one submission ring whose index array is the identity, ops
+     * written straight into the shared SQE array, and completions reaped from the shared CQ ring.
+     */
+    class UringBackend
+    {
+    private:
+        int _fd = -1;
+        void* _sqRing = MAP_FAILED;
+        std::size_t _sqRingSize = 0;
+        void* _cqRing = MAP_FAILED;
+        std::size_t _cqRingSize = 0;
+        io_uring_sqe* _sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+        std::size_t _sqesSize = 0;
+
+        unsigned* _sqTail = nullptr;
+        unsigned _sqMask = 0;
+        unsigned* _cqHead = nullptr;
+        unsigned* _cqTail = nullptr;
+        unsigned _cqMask = 0;
+        io_uring_cqe* _cqes = nullptr;
+
+        unsigned _unsubmitted = 0;
+
+        template<typename T = unsigned char>
+        static T* At(void* base, std::uint32_t offset) noexcept
+        {
+            return reinterpret_cast<T*>(static_cast<unsigned char*>(base) + offset);
+        }
+
+        static void* Map(int fd, std::size_t size, off_t offset) noexcept
+        {
+            return ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, offset);
+        }
+
+        UringBackend() = default;
+
+    public:
+        UringBackend(UringBackend const&) = delete;
+        UringBackend& operator=(UringBackend const&) = delete;
+
+        ~UringBackend()
+        {
+            if (_sqes != MAP_FAILED) ::munmap(_sqes, _sqesSize);
+            if (_cqRing != MAP_FAILED) ::munmap(_cqRing, _cqRingSize);
+            if (_sqRing != MAP_FAILED) ::munmap(_sqRing, _sqRingSize);
+            if (_fd >= 0) ::close(_fd);
+        }
+
+        static Result<std::unique_ptr<UringBackend>, IoError> Create(unsigned entries)
+        {
+            using Created = Result<std::unique_ptr<UringBackend>, IoError>;
+
+            io_uring_params params{};
+            std::unique_ptr<UringBackend> ring(new UringBackend());
+
+            ring->_fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+            if (ring->_fd < 0) return Created(ErrTag, IoError::Last());
+
+            ring->_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+            ring->_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+            ring->_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+            ring->_sqRing = Map(ring->_fd, ring->_sqRingSize, IORING_OFF_SQ_RING);
+            if (ring->_sqRing == MAP_FAILED) return Created(ErrTag, IoError::Last());
+
+            ring->_cqRing = Map(ring->_fd, ring->_cqRingSize, IORING_OFF_CQ_RING);
+            if (ring->_cqRing == MAP_FAILED) return Created(ErrTag, IoError::Last());
+
+            ring->_sqes = static_cast<io_uring_sqe*>(Map(ring->_fd, ring->_sqesSize, IORING_OFF_SQES));
+            if (ring->_sqes == MAP_FAILED) return Created(ErrTag, IoError::Last());
+
+            ring->_sqTail = At<unsigned>(ring->_sqRing, params.sq_off.tail);
+            ring->_sqMask = *At<unsigned>(ring->_sqRing, params.sq_off.ring_mask);
+            ring->_cqHead = At<unsigned>(ring->_cqRing, params.cq_off.head);
+            ring->_cqTail = At<unsigned>(ring->_cqRing, params.cq_off.tail);
+            ring->_cqMask = *At<unsigned>(ring->_cqRing, params.cq_off.ring_mask);
+            ring->_cqes = At<io_uring_cqe>(ring->_cqRing, params.cq_off.cqes);
+
+            unsigned* array = At<unsigned>(ring->_sqRing, params.sq_off.array);
+            for (unsigned i = 0; i < params.sq_entries; ++i) array[i] = i;
+
+            return Created(OkTag, std::move(ring));
+        }
+
+        /**
+         * Writes ``op`` into the next SQE. The caller bounds in-flight ops by the ring size, so a slot is free.
+         */
+        void Queue(IoOp const& op) noexcept
+        {
+            unsigned const tail = *_sqTail;
+            io_uring_sqe& sqe = _sqes[tail & _sqMask];
+            std::memset(&sqe, 0, sizeof(sqe));
+
+            switch (op.kind)
+            {
+            case IoOpKind::Read: sqe.opcode = IORING_OP_READ; break;
+            case IoOpKind::Write: sqe.opcode = IORING_OP_WRITE; break;
+            case IoOpKind::ReadFixed: sqe.opcode = IORING_OP_READ_FIXED; break;
+            case IoOpKind::WriteFixed: sqe.opcode = IORING_OP_WRITE_FIXED; break;
+            }
+
+            sqe.fd = op.fd;
+            sqe.addr = reinterpret_cast<std::uint64_t>(op.data);
+            sqe.len = op.length;
+            sqe.off = op.offset;
+            sqe.buf_index = op.bufferIndex;
+            sqe.user_data = op.id;
+
+            std::atomic_ref(*_sqTail).store(tail + 1, std::memory_order_release);
+            ++_unsubmitted;
+        }
+
+        /**
+         * Submits every queued op and optionally waits for ``waitFor`` completions, in a single ``io_uring_enter``.
+         */
+        Result<std::size_t, IoError> Submit(std::size_t waitFor)
+        {
+            std::size_t const submitted = _unsubmitted;
+
+            while (_unsubmitted > 0 || waitFor > 0)
+            {
+                unsigned const flags = waitFor > 0 ? IORING_ENTER_GETEVENTS : 0;
+                long const entered = ::syscall(__NR_io_uring_enter, _fd, _unsubmitted, static_cast<unsigned>(waitFor),
+                                               flags, nullptr, 0);
+                if (entered < 0)
+                {
+                    if (errno == EINTR) continue;
+                    return Completion(ErrTag, IoError::Last());
+                }
+
+                _unsubmitted -= static_cast<unsigned>(entered);
+                if (_unsubmitted == 0) break;
+            }
+
+            return Completion(OkTag, submitted);
+        }
+
+        void Reap(std::vector<IoCompletion>& out)
+        {
+            unsigned head = *_cqHead;
+            unsigned const tail = std::atomic_ref(*_cqTail).load(std::memory_order_acquire);
+
+            for (; head != tail; ++head)
+            {
+                io_uring_cqe const& cqe = _cqes[head & _cqMask];
+                out.push_back(IoCompletion{cqe.user_data, cqe.res < 0
+                                                              ? Completion(ErrTag, IoError{-cqe.res})
+                                                              : Completion(OkTag, static_cast<std::size_t>(cqe.res))});
+            }
+
+            std::atomic_ref(*_cqHead).store(head, std::memory_order_release);
+        }
+
+        Result<std::monostate, IoError> RegisterBuffers(std::vector<iovec> const& buffers)
+        {
+            using Registered = Result<std::monostate, IoError>;
+
+            ::syscall(__NR_io_uring_register, _fd, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+            if (buffers.empty()) return Registered(OkTag, std::monostate());
+
+            if (::syscall(__NR_io_uring_register, _fd, IORING_REGISTER_BUFFERS, buffers.data(), buffers.size()) < 0)
+                return Registered(ErrTag, IoError::Last());
+
+            return Registered(OkTag, std::monostate());
+        }
+    };
+#endif
+} // namespace internal
+
+/**
+ * Batched asynchronous file I/O. ``Read``/``Write`` only queue an op; ``Submit`` hands every queued op to the kernel
+ * in one syscall, and ``Poll``/``Wait`` run the completion handlers, on the calling thread, with a
+ * ``Result<std::size_t, IoError>`` that can be chained with ``AndThen``/``MapErr``. Handlers may queue further ops.
+ *
+ * Buffers must stay alive until their op completes; the ring waits for every in-flight op when destroyed.
+ */
+class Ring
+{
+private:
+#ifdef M24_IO_URING
+    std::unique_ptr<internal::UringBackend> _uring;
+#endif
+    std::unique_ptr<internal::PoolIoBackend> _pool;
+
+    std::size_t _entries = 0;
+    std::size_t _inFlight = 0;
+    std::vector<CompletionHandler> _handlers;
+    std::vector<std::uint64_t> _freeIds;
+    std::vector<iovec> _buffers;
+    std::vector<internal::IoCompletion> _reaped;
+
+    Ring() = default;
+
+    [[nodiscard]] bool IsValid() const noexcept
+    {
+#ifdef M24_IO_URING
+        if (_uring) return true;
+#endif
+        return _pool != nullptr;
+    }
+
+    Result<std::size_t, IoError> SubmitAndWait(std::size_t waitFor)
+    {
+#ifdef M24_IO_URING
+        if (_uring) return _uring->Submit(waitFor);
+#endif
+        return _pool->Submit(waitFor);
+    }
+
+    std::size_t Dispatch()
+    {
+        std::vector<internal::IoCompletion> reaped = std::exchange(_reaped, {});
+        reaped.clear();
+
+#ifdef M24_IO_URING
+        if (_uring)
+            _uring->Reap(reaped);
+        else
+#endif
+            _pool->Reap(reaped);
+
+        _inFlight -= reaped.size();
+        for (internal::IoCompletion& completion : reaped)
+        {
+            CompletionHandler handler = std::move(_handlers[completion.id]);
+            _freeIds.push_back(completion.id);
+            if (handler) handler(std::move(completion.result));
+        }
+
+        std::size_t const dispatched = reaped.size();
+        _reaped = std::move(reaped);
+        return dispatched;
+    }
+
+    Result<std::monostate, IoError> Enqueue(internal::IoOp op, CompletionHandler handler)
+    {
+        using Queued = Result<std::monostate, IoError>;
+
+        while (_inFlight == _entries)
+        {
+            Completion waited = Wait(1);
+            if (waited.IsErr()) return Queued(ErrTag, m24::internal::Unchecked::Err(std::move(waited)));
+        }
+
+        if (_freeIds.empty())
+        {
+            _freeIds.push_back(_handlers.size());
+            _handlers.emplace_back();
+        }
+
+        op.id = _freeIds.back();
+        _freeIds.pop_back();
+        _handlers[op.id] = std::move(handler);
+        ++_inFlight;
+
+#ifdef M24_IO_URING
+        if (_uring)
+        {
+            _uring->Queue(op);
+            return Queued(OkTag, std::monostate());
+        }
+#endif
+        _pool->Queue(op);
+        return Queued(OkTag, std::monostate());
+    }
+
+    Result<std::monostate, IoError> EnqueueFixed(internal::IoOpKind kind, File const& file, std::uint16_t bufferIndex,
+                                                 std::uint32_t length, std::uint64_t offset, CompletionHandler handler)
+    {
+        if (bufferIndex >= _buffers.size() || length > _buffers[bufferIndex].iov_len)
+            return Result<std::monostate, IoError>(ErrTag, IoError{EINVAL});
+
+        return Enqueue(internal::IoOp{kind, file.Native(), _buffers[bufferIndex].iov_base, length, bufferIndex, offset,
+                                      0},
+                       std::move(handler));
+    }
+
+public:
+#pragma region Constructors
+    /**
+     * @param entries Most ops in flight at once; queueing beyond it first waits for a completion.
+     */
+    static Result<Ring, IoError> Create(unsigned entries = 64, RingBackend backend = RingBackend::Auto)
+    {
+        using Created = Result<Ring, IoError>;
+
+        Ring ring;
+        ring._entries = std::max(entries, 1u);
+
+#ifdef M24_IO_URING
+        if (backend != RingBackend::ThreadPool)
+        {
+            auto uring = internal::UringBackend::Create(static_cast<unsigned>(ring._entries));
+            if (uring.IsOk())
+            {
+                ring._uring = m24::internal::Unchecked::Value(std::move(uring));
+                return Created(OkTag, std::move(ring));
+            }
+
+            if (backend == RingBackend::IoUring) return Created(ErrTag, m24::internal::Unchecked::Err(std::move(uring)));
+        }
+#else
+        if (backend == RingBackend::IoUring) return Created(ErrTag, IoError{ENOSYS});
+#endif
+
+        ring._pool = std::make_unique<internal::PoolIoBackend>(std::min<std::size_t>(ring._entries, 4));
+        return Created(OkTag, std::move(ring));
+    }
+
+    Ring(Ring&&) noexcept = default;
+    Ring& operator=(Ring&&) = delete;
+
+    ~Ring()
+    {
+        if (IsValid()) Drain();
+    }
+#pragma endregion
+
+#pragma region Backend
+    [[nodiscard]] RingBackend Backend() const noexcept
+    {
+#ifdef M24_IO_URING
+        if (_uring) return RingBackend::IoUring;
+#endif
+        return RingBackend::ThreadPool;
+    }
+
+    /**
+     * @return Ops queued or submitted whose handler has not run yet.
+     */
+    [[nodiscard]] std::size_t InFlight() const noexcept
+    {
+        return _inFlight;
+    }
+#pragma endregion
+
+#pragma region RegisterBuffers
+    /**
+     * Registers ``buffers`` with the kernel so ``ReadFixed``/``WriteFixed`` skip per-op page pinning and copying
+     * setup. Replaces any earlier registration; fails with ``EBUSY`` while ops are in flight.
+     */
+    Result<std::monostate, IoError> RegisterBuffers(std::span<std::span<std::byte> const> buffers)
+    {
+        using Registered = Result<std::monostate, IoError>;
+
+        if (_inFlight > 0) return Registered(ErrTag, IoError{EBUSY});
+
+        std::vector<iovec> iovecs;
+        iovecs.reserve(buffers.size());
+        for (std::span<std::byte> buffer : buffers) iovecs.push_back(iovec{buffer.data(), buffer.size()});
+
+#ifdef M24_IO_URING
+        if (_uring)
+        {
+            Registered registered = _uring->RegisterBuffers(iovecs);
+            if (registered.IsErr()) return registered;
+        }
+#endif
+
+        _buffers = std::move(iovecs);
+        return Registered(OkTag, std::monostate());
+    }
+#pragma endregion
+
+#pragma region Read
+    /**
+     * Queues a read of up to ``buffer.size()`` bytes at ``offset``.
+     *
+     * @return Err only if room could not be made for the op; its handler is then never called.
+     */
+    Result<std::monostate, IoError> Read(File const& file, std::span<std::byte> buffer, std::uint64_t offset,
+                                         CompletionHandler handler)
+    {
+        return Enqueue(internal::IoOp{internal::IoOpKind::Read, file.Native(), buffer.data(),
+                                      static_cast<std::uint32_t>(buffer.size()), 0, offset, 0},
+                       std::move(handler));
+    }
+
+    /**
+     * Queues a read of ``length`` bytes into registered buffer ``bufferIndex``.
+     *
+     * @return Err ``EINVAL`` if the buffer is not registered or too small.
+     */
+    Result<std::monostate, IoError> ReadFixed(File const& file, std::uint16_t bufferIndex, std::uint32_t length,
+                                              std::uint64_t offset, CompletionHandler handler)
+    {
+        return EnqueueFixed(internal::IoOpKind::ReadFixed, file, bufferIndex, length, offset, std::move(handler));
+    }
+#pragma endregion
+
+#pragma region Write
+    /**
+     * Queues a write of ``data`` at ``offset``.
+     *
+     * @return Err only if room could not be made for the op; its handler is then never called.
+     */
+    Result<std::monostate, IoError> Write(File const& file, std::span<std::byte const> data, std::uint64_t offset,
+                                          CompletionHandler handler)
+    {
+        return Enqueue(internal::IoOp{internal::IoOpKind::Write, file.Native(), const_cast<std::byte*>(data.data()),
+                                      static_cast<std::uint32_t>(data.size()), 0, offset, 0},
+                       std::move(handler));
+    }
+
+    /**
+     * Queues a write of the first ``length`` bytes of registered buffer ``bufferIndex``.
+     *
+     * @return Err ``EINVAL`` if the buffer is not registered or too small.
+     */
+    Result<std::monostate, IoError> WriteFixed(File const& file, std::uint16_t bufferIndex, std::uint32_t length,
+                                               std::uint64_t offset, CompletionHandler handler)
+    {
+        return EnqueueFixed(internal::IoOpKind::WriteFixed, file, bufferIndex, length, offset, std::move(handler));
+    }
+#pragma endregion
+
+#pragma region Submit
+    /**
+     * Hands every queued op to the backend in one batch, without waiting.
+     *
+     * @return The number of ops submitted.
+     */
+    Result<std::size_t, IoError> Submit()
+    {
+        return SubmitAndWait(0);
+    }
+
+    /**
+     * Runs the handlers of ops that have already completed, without blocking.
+     *
+     * @return The number of handlers run.
+     */
+    std::size_t Poll()
+    {
+        return Dispatch();
+    }
+
+    /**
+     * Submits queued ops, blocks until at least ``minimum`` have completed, and runs their handlers.
+     *
+     * @return The number of handlers run.
+     */
+    Result<std::size_t, IoError> Wait(std::size_t minimum = 1)
+    {
+        minimum = std::min(minimum, _inFlight);
+
+        Completion submitted = SubmitAndWait(minimum);
+        if (submitted.IsErr()) return submitted;
+
+        return Completion(OkTag, Dispatch());
+    }
+
+    /**
+     * Waits until every op, including ones queued by handlers along the way, has completed.
+     *
+     * @return The number of handlers run.
+     */
+    Result<std::size_t, IoError> Drain()
+    {
+        std::size_t total = 0;
+        while (_inFlight > 0)
+        {
+            Completion waited = Wait(_inFlight);
+            if (waited.IsErr()) return waited;
+
+            total += m24::internal::Unchecked::Value(waited);
+        }
+
+        return Completion(OkTag, total);
+    }
+#pragma endregion
+};
+
+} // namespace m24::io
+
+#endif // IO_H
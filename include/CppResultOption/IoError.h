@@ -0,0 +1,45 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef IO_ERROR_H
+#define IO_ERROR_H
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+namespace m24::io
+{
+
+/**
+ * An ``errno`` value. Kept to a single int so ``Result<std::size_t, IoError>`` stays two words wide.
+ */
+struct IoError
+{
+    int code = 0;
+
+    /**
+     * @return The calling thread's current ``errno``.
+     */
+    static IoError Last() noexcept
+    {
+        return IoError{errno};
+    }
+
+    [[nodiscard]] std::error_code ToErrorCode() const noexcept
+    {
+        return std::error_code(code, std::generic_category());
+    }
+
+    [[nodiscard]] std::string Message() const
+    {
+        return ToErrorCode().message();
+    }
+
+    bool operator==(IoError const&) const = default;
+};
+
+} // namespace m24::io
+
+#endif // IO_ERROR_H
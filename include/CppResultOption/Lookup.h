@@ -0,0 +1,138 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef LOOKUP_H
+#define LOOKUP_H
+
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "OptionRef.h"
+#include "Result.h"
+#include "ResultTags.h"
+
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace m24
+{
+
+namespace internal
+{
+    template<typename Container>
+    concept MapLike = requires { typename std::remove_cvref_t<Container>::mapped_type; };
+
+    /**
+     * The mapped value for maps, the element itself for sets.
+     */
+    template<typename Container, typename Iterator>
+    auto& LookupTarget(Iterator it) noexcept
+    {
+        if constexpr (MapLike<Container>)
+            return it->second;
+        else
+            return *it;
+    }
+
+    template<typename Container>
+    using ElementOf = std::remove_reference_t<decltype(*std::declval<Container&>().begin())>;
+} // namespace internal
+
+#pragma region Find
+/**
+ * Single-probe replacement for ``contains`` followed by ``at``: one ``find`` on a map or set, no copy.
+ * Heterogeneous keys are forwarded as-is, so a transparent comparator or hash (e.g. ``std::less<>``) avoids
+ * building a temporary ``key_type``.
+ *
+ * @return The mapped value (maps) or the element (sets), None if absent.
+ */
+template<typename Container, typename Key>
+    requires requires(Container& container, Key const& key) { container.find(key); }
+auto Find(Container& container, Key const& key) noexcept(noexcept(container.find(key)))
+{
+    auto const it = container.find(key);
+    using Target = std::remove_reference_t<decltype(internal::LookupTarget<Container>(it))>;
+
+    return OptionRef<Target>::FromPointer(it == container.end() ? nullptr : &internal::LookupTarget<Container>(it));
+}
+#pragma endregion
+
+#pragma region Get
+/**
+ * Bounds-checked indexing without the exception of ``at``. Restricted to random-access sequences: a map's
+ * ``operator[]`` would insert, so use ``Find`` there.
+ */
+template<typename Container>
+    requires std::ranges::random_access_range<Container> && std::ranges::sized_range<Container> &&
+             requires(Container& container, std::size_t index) { container[index]; }
+auto Get(Container& container, std::size_t index) noexcept
+{
+    using Target = std::remove_reference_t<decltype(container[index])>;
+
+    return OptionRef<Target>::FromPointer(index < container.size() ? &container[index] : nullptr);
+}
+#pragma endregion
+
+#pragma region Front
+template<typename Container>
+auto Front(Container& container) noexcept
+{
+    using Target = internal::ElementOf<Container>;
+
+    return OptionRef<Target>::FromPointer(container.empty() ? nullptr : &container.front());
+}
+
+template<typename Container>
+auto Back(Container& container) noexcept
+{
+    using Target = internal::ElementOf<Container>;
+
+    return OptionRef<Target>::FromPointer(container.empty() ? nullptr : &container.back());
+}
+#pragma endregion
+
+#pragma region PopFront
+/**
+ * Moves the first element out and removes it, None if empty.
+ */
+template<typename Container>
+    requires requires(Container& container) { container.pop_front(); }
+Option<typename Container::value_type> PopFront(Container& container)
+{
+    if (container.empty()) return Prelude::None;
+
+    Option<typename Container::value_type> result(std::move(container.front()));
+    container.pop_front();
+    return result;
+}
+#pragma endregion
+
+#pragma region TryEmplace
+/**
+ * One ``try_emplace`` on a map: ``args`` are only consumed if ``key`` was absent.
+ *
+ * @return Ok with the newly inserted value, or Err with the value already stored under ``key``.
+ */
+template<typename Map, typename Key, typename... Args>
+    requires requires(Map& map, Key&& key, Args&&... args) {
+        map.try_emplace(std::forward<Key>(key), std::forward<Args>(args)...);
+    }
+Result<std::reference_wrapper<typename Map::mapped_type>, std::reference_wrapper<typename Map::mapped_type>>
+TryEmplace(Map& map, Key&& key, Args&&... args)
+{
+    using Outcome =
+        Result<std::reference_wrapper<typename Map::mapped_type>, std::reference_wrapper<typename Map::mapped_type>>;
+
+    auto [it, inserted] = map.try_emplace(std::forward<Key>(key), std::forward<Args>(args)...);
+    if (inserted) return Outcome(OkTag, std::ref(it->second));
+
+    return Outcome(ErrTag, std::ref(it->second));
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // LOOKUP_H
@@ -0,0 +1,103 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef MASKED_RANGE_H
+#define MASKED_RANGE_H
+
+#include "ValidityBitmap.h"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace m24::internal
+{
+
+/**
+ * Forward iterator over the elements of a value column whose bit is set in a validity bitmap.
+ * Runs of unset bits are skipped a bitmap word at a time.
+ */
+template<typename T>
+class MaskedIterator
+{
+private:
+    ValidityBitmap const* _mask = nullptr;
+    T* _values = nullptr;
+    std::size_t _index = 0;
+
+public:
+    using value_type = std::remove_const_t<T>;
+    using reference = T&;
+    using difference_type = std::ptrdiff_t;
+    using iterator_concept = std::forward_iterator_tag;
+
+    MaskedIterator() = default;
+
+    MaskedIterator(ValidityBitmap const* mask, T* values, std::size_t index)
+        : _mask(mask),
+          _values(values),
+          _index(mask->FindNext(index))
+    {
+    }
+
+    reference operator*() const
+    {
+        return _values[_index];
+    }
+
+    /**
+     * @return Position of the current element in the underlying column.
+     */
+    [[nodiscard]] std::size_t Index() const noexcept
+    {
+        return _index;
+    }
+
+    MaskedIterator& operator++()
+    {
+        _index = _mask->FindNext(_index + 1);
+        return *this;
+    }
+
+    MaskedIterator operator++(int)
+    {
+        MaskedIterator result = *this;
+        ++*this;
+        return result;
+    }
+
+    bool operator==(MaskedIterator const& other) const noexcept
+    {
+        return _index == other._index;
+    }
+};
+
+template<typename T>
+class MaskedRange
+{
+private:
+    ValidityBitmap const* _mask;
+    T* _values;
+
+public:
+    MaskedRange(ValidityBitmap const& mask, T* values)
+        : _mask(&mask),
+          _values(values)
+    {
+    }
+
+    MaskedIterator<T> begin() const
+    {
+        return MaskedIterator<T>(_mask, _values, 0);
+    }
+
+    MaskedIterator<T> end() const
+    {
+        return MaskedIterator<T>(_mask, _values, _mask->size());
+    }
+};
+
+} // namespace m24::internal
+
+#endif // MASKED_RANGE_H
@@ -0,0 +1,430 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef NULLABLE_KERNELS_H
+#define NULLABLE_KERNELS_H
+
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "OptionVector.h"
+#include "ValidityBitmap.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define M24_KERNELS_X86 1
+#include <immintrin.h>
+#else
+#define M24_KERNELS_X86 0
+#endif
+
+/**
+ * Bulk counterparts of ``Option::Map``/``Filter``/``UnwrapOr``/``IsSomeAnd`` and Some-only reductions,
+ * operating on a value column plus validity bitmap (see ``OptionVector``).
+ *
+ * The portable kernels walk the bitmap a word (64 elements) at a time, skip empty words, and use
+ * branch-free selects over several independent accumulators so the compiler can vectorize them.
+ * For ``double`` columns the reductions additionally dispatch at runtime to hand-written AVX2 code.
+ * Floating-point sums are therefore reassociated and may differ from a sequential loop in the last ulps.
+ */
+namespace m24::Kernels
+{
+
+namespace internal
+{
+    using Word = ValidityBitmap::Word;
+
+    inline constexpr std::size_t Lanes = 8;
+
+    template<typename T>
+    constexpr T MinIdentity() noexcept
+    {
+        if constexpr (std::numeric_limits<T>::has_infinity) return std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::max();
+    }
+
+    template<typename T>
+    constexpr T MaxIdentity() noexcept
+    {
+        if constexpr (std::numeric_limits<T>::has_infinity) return -std::numeric_limits<T>::infinity();
+        return std::numeric_limits<T>::lowest();
+    }
+
+    /**
+     * Calls ``visit(i)`` for the Some slots only. Fully Some words take a dense loop the compiler can vectorize;
+     * the rest walk their set bits.
+     */
+    template<typename Visit>
+    void ForEachSome(std::span<Word const> words, Visit&& visit)
+    {
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+            Word bits = words[w];
+            std::size_t const first = w * ValidityBitmap::WordBits;
+
+            if (bits == ~Word{0})
+            {
+                for (std::size_t j = 0; j < ValidityBitmap::WordBits; ++j) visit(first + j);
+                continue;
+            }
+
+            for (; bits != 0; bits &= bits - 1) visit(first + static_cast<std::size_t>(std::countr_zero(bits)));
+        }
+    }
+
+    /**
+     * Folds every Some value into ``Lanes`` independent accumulators with ``combine(acc, value)``.
+     * None values are replaced by ``identity`` so the inner loop stays branch-free.
+     */
+    template<typename T, typename Combine>
+    T ReduceScalar(std::span<T const> values, ValidityBitmap const& validity, T identity, Combine combine)
+    {
+        assert(values.size() == validity.size());
+
+        T acc[Lanes];
+        std::fill_n(acc, Lanes, identity);
+
+        std::span<Word const> const words = validity.Words();
+        for (std::size_t w = 0; w < words.size(); ++w)
+        {
+            Word const bits = words[w];
+            if (bits == 0) continue;
+
+            T const* block = values.data() + w * ValidityBitmap::WordBits;
+            std::size_t const count = std::min(ValidityBitmap::WordBits, values.size() - w * ValidityBitmap::WordBits);
+
+            if (bits == ~Word{0})
+            {
+                for (std::size_t j = 0; j < ValidityBitmap::WordBits; j += Lanes)
+                {
+                    for (std::size_t k = 0; k < Lanes; ++k) acc[k] = combine(acc[k], block[j + k]);
+                }
+                continue;
+            }
+
+            for (std::size_t j = 0; j < count; ++j)
+            {
+                T const value = (bits >> j) & 1 ? block[j] : identity;
+                acc[j % Lanes] = combine(acc[j % Lanes], value);
+            }
+        }
+
+        T result = identity;
+        for (T const lane : acc) result = combine(result, lane);
+        return result;
+    }
+
+    template<typename T>
+    T SumScalar(std::span<T const> values, ValidityBitmap const& validity)
+    {
+        return ReduceScalar<T>(values, validity, T{}, [](T acc, T value) { return static_cast<T>(acc + value); });
+    }
+
+    /**
+     * What ``Mean`` sums in: 64-bit for integers, so narrow columns cannot wrap, and double for floating point.
+     */
+    template<typename T>
+    using MeanAccumulator = std::conditional_t<std::is_floating_point_v<T>, double,
+                                               std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>>;
+
+    template<typename T>
+    MeanAccumulator<T> WideSum(std::span<T const> values, ValidityBitmap const& validity)
+    {
+        MeanAccumulator<T> sum{};
+        ForEachSome(validity.Words(), [&](std::size_t i) { sum += static_cast<MeanAccumulator<T>>(values[i]); });
+        return sum;
+    }
+
+    template<typename T>
+    T MinScalar(std::span<T const> values, ValidityBitmap const& validity)
+    {
+        return ReduceScalar<T>(values, validity, MinIdentity<T>(), [](T acc, T value) { return value < acc ? value : acc; });
+    }
+
+    template<typename T>
+    T MaxScalar(std::span<T const> values, ValidityBitmap const& validity)
+    {
+        return ReduceScalar<T>(values, validity, MaxIdentity<T>(), [](T acc, T value) { return acc < value ? value : acc; });
+    }
+
+#if M24_KERNELS_X86
+#pragma region AVX2
+    inline bool HasAvx2() noexcept
+    {
+        static bool const hasAvx2 = __builtin_cpu_supports("avx2");
+        return hasAvx2;
+    }
+
+    /**
+     * Expands the low four bits of ``bits`` into an all-ones/all-zeros mask per double lane.
+     */
+    __attribute__((target("avx2"))) inline __m256d LaneMask(Word bits) noexcept
+    {
+        __m256i const selectors = _mm256_setr_epi64x(1, 2, 4, 8);
+        __m256i const broadcast = _mm256_set1_epi64x(static_cast<long long>(bits & 0xF));
+        return _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(broadcast, selectors), selectors));
+    }
+
+    enum class ReduceOp
+    {
+        Sum,
+        Min,
+        Max,
+    };
+
+    template<ReduceOp Op>
+    __attribute__((target("avx2"))) inline __m256d Combine(__m256d acc, __m256d value) noexcept
+    {
+        if constexpr (Op == ReduceOp::Sum) return _mm256_add_pd(acc, value);
+        if constexpr (Op == ReduceOp::Min) return _mm256_min_pd(value, acc);
+        if constexpr (Op == ReduceOp::Max) return _mm256_max_pd(value, acc);
+    }
+
+    template<ReduceOp Op>
+    inline double Combine(double acc, double value) noexcept
+    {
+        if constexpr (Op == ReduceOp::Sum) return acc + value;
+        if constexpr (Op == ReduceOp::Min) return value < acc ? value : acc;
+        if constexpr (Op == ReduceOp::Max) return acc < value ? value : acc;
+    }
+
+    template<ReduceOp Op>
+    __attribute__((target("avx2"))) inline double ReduceAvx2(std::span<double const> values,
+                                                             ValidityBitmap const& validity, double identity)
+    {
+        assert(values.size() == validity.size());
+
+        __m256d const identities = _mm256_set1_pd(identity);
+        __m256d acc0 = identities;
+        __m256d acc1 = identities;
+
+        std::span<Word const> const words = validity.Words();
+        std::size_t const fullWords = values.size() / ValidityBitmap::WordBits;
+        for (std::size_t w = 0; w < fullWords; ++w)
+        {
+            Word bits = words[w];
+            if (bits == 0) continue;
+
+            double const* block = values.data() + w * ValidityBitmap::WordBits;
+            for (std::size_t j = 0; j < ValidityBitmap::WordBits; j += 8, bits >>= 8)
+            {
+                __m256d const v0 = _mm256_blendv_pd(identities, _mm256_loadu_pd(block + j), LaneMask(bits));
+                __m256d const v1 = _mm256_blendv_pd(identities, _mm256_loadu_pd(block + j + 4), LaneMask(bits >> 4));
+                acc0 = Combine<Op>(acc0, v0);
+                acc1 = Combine<Op>(acc1, v1);
+            }
+        }
+
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, Combine<Op>(acc0, acc1));
+
+        double result = identity;
+        for (double const lane : lanes) result = Combine<Op>(result, lane);
+
+        for (std::size_t i = fullWords * ValidityBitmap::WordBits; i < values.size(); ++i)
+        {
+            if (validity.Test(i)) result = Combine<Op>(result, values[i]);
+        }
+
+        return result;
+    }
+#pragma endregion
+#endif
+} // namespace internal
+
+#pragma region Reductions
+/**
+ * @return Sum of the Some values; ``T{}`` if there are none.
+ */
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+T Sum(std::span<T const> values, ValidityBitmap const& validity)
+{
+#if M24_KERNELS_X86
+    if constexpr (std::is_same_v<T, double>)
+    {
+        if (internal::HasAvx2()) return internal::ReduceAvx2<internal::ReduceOp::Sum>(values, validity, 0.0);
+    }
+#endif
+    return internal::SumScalar(values, validity);
+}
+
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+Option<T> Min(std::span<T const> values, ValidityBitmap const& validity)
+{
+    if (validity.Count() == 0) return Prelude::None;
+
+#if M24_KERNELS_X86
+    if constexpr (std::is_same_v<T, double>)
+    {
+        if (internal::HasAvx2())
+            return Prelude::Some(
+                internal::ReduceAvx2<internal::ReduceOp::Min>(values, validity, internal::MinIdentity<double>()));
+    }
+#endif
+    return Prelude::Some(internal::MinScalar(values, validity));
+}
+
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+Option<T> Max(std::span<T const> values, ValidityBitmap const& validity)
+{
+    if (validity.Count() == 0) return Prelude::None;
+
+#if M24_KERNELS_X86
+    if constexpr (std::is_same_v<T, double>)
+    {
+        if (internal::HasAvx2())
+            return Prelude::Some(
+                internal::ReduceAvx2<internal::ReduceOp::Max>(values, validity, internal::MaxIdentity<double>()));
+    }
+#endif
+    return Prelude::Some(internal::MaxScalar(values, validity));
+}
+
+template<typename T>
+    requires(std::is_arithmetic_v<T>)
+Option<double> Mean(std::span<T const> values, ValidityBitmap const& validity)
+{
+    std::size_t const count = validity.Count();
+    if (count == 0) return Prelude::None;
+
+    if constexpr (std::is_same_v<T, double>)
+        return Prelude::Some(Sum(values, validity) / static_cast<double>(count));
+    else
+        return Prelude::Some(static_cast<double>(internal::WideSum(values, validity)) / static_cast<double>(count));
+}
+
+template<typename T>
+T Sum(OptionVector<T> const& column)
+{
+    return Sum(column.Values(), column.Validity());
+}
+
+template<typename T>
+Option<T> Min(OptionVector<T> const& column)
+{
+    return Min(column.Values(), column.Validity());
+}
+
+template<typename T>
+Option<T> Max(OptionVector<T> const& column)
+{
+    return Max(column.Values(), column.Validity());
+}
+
+template<typename T>
+Option<double> Mean(OptionVector<T> const& column)
+{
+    return Mean(column.Values(), column.Validity());
+}
+#pragma endregion
+
+#pragma region IsSomeAnd
+/**
+ * Element-wise ``Option::IsSomeAnd``: bit ``i`` of the result is set iff element ``i`` is Some and satisfies ``predicate``.
+ */
+template<typename T, typename Predicate>
+ValidityBitmap IsSomeAnd(std::span<T const> values, ValidityBitmap const& validity, Predicate&& predicate)
+{
+    assert(values.size() == validity.size());
+
+    ValidityBitmap result(values.size());
+    std::span<internal::Word> const target = result.Words();
+    internal::ForEachSome(validity.Words(), [&](std::size_t i) {
+        target[i / ValidityBitmap::WordBits] |=
+            static_cast<internal::Word>(predicate(values[i]) ? 1 : 0) << (i % ValidityBitmap::WordBits);
+    });
+
+    return result;
+}
+
+template<typename T, typename Predicate>
+ValidityBitmap IsSomeAnd(OptionVector<T> const& column, Predicate&& predicate)
+{
+    return IsSomeAnd(column.Values(), column.Validity(), std::forward<Predicate>(predicate));
+}
+#pragma endregion
+
+#pragma region Filter
+/**
+ * Element-wise ``Option::Filter``: Some values failing ``predicate`` become None.
+ */
+template<typename T, typename Predicate>
+OptionVector<T> Filter(OptionVector<T> const& column, Predicate&& predicate)
+{
+    ValidityBitmap validity = IsSomeAnd(column, std::forward<Predicate>(predicate));
+
+    std::span<T const> const source = column.Values();
+    std::vector<T> values(source.size());
+    internal::ForEachSome(validity.Words(), [&](std::size_t i) { values[i] = source[i]; });
+
+    return OptionVector<T>(std::move(values), std::move(validity));
+}
+#pragma endregion
+
+#pragma region Map
+/**
+ * Element-wise ``Option::Map``: applies ``functor`` to Some values only, None stays None.
+ */
+template<typename R, typename T, typename Functor>
+OptionVector<R> Map(OptionVector<T> const& column, Functor&& functor)
+{
+    std::span<T const> const source = column.Values();
+
+    std::vector<R> values(source.size());
+    internal::ForEachSome(column.Validity().Words(), [&](std::size_t i) { values[i] = functor(source[i]); });
+
+    return OptionVector<R>(std::move(values), column.Validity());
+}
+#pragma endregion
+
+#pragma region UnwrapOr
+/**
+ * Element-wise ``Option::UnwrapOr``: writes a dense column with None slots replaced by ``defaultValue``.
+ */
+template<typename T>
+std::vector<T> UnwrapOr(std::span<T const> values, ValidityBitmap const& validity, T const& defaultValue)
+{
+    assert(values.size() == validity.size());
+
+    std::vector<T> result(values.size());
+    std::span<internal::Word const> const words = validity.Words();
+    for (std::size_t w = 0; w < words.size(); ++w)
+    {
+        internal::Word const bits = words[w];
+        std::size_t const first = w * ValidityBitmap::WordBits;
+        std::size_t const count = std::min(ValidityBitmap::WordBits, values.size() - first);
+
+        if (bits == 0)
+        {
+            std::fill_n(result.data() + first, count, defaultValue);
+            continue;
+        }
+
+        for (std::size_t j = 0; j < count; ++j) result[first + j] = (bits >> j) & 1 ? values[first + j] : defaultValue;
+    }
+
+    return result;
+}
+
+template<typename T>
+std::vector<T> UnwrapOr(OptionVector<T> const& column, T const& defaultValue)
+{
+    return UnwrapOr(column.Values(), column.Validity(), defaultValue);
+}
+#pragma endregion
+
+} // namespace m24::Kernels
+
+#endif // NULLABLE_KERNELS_H
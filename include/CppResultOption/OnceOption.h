@@ -0,0 +1,267 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef ONCE_OPTION_H
+#define ONCE_OPTION_H
+
+#include "Option.h"
+#include "OptionRef.h"
+#include "Result.h"
+#include "ResultPrelude.h"
+#include "Unchecked.h"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace m24
+{
+
+namespace internal
+{
+    enum class OnceState : std::uint8_t
+    {
+        Empty,
+        Running,
+        Ready
+    };
+} // namespace internal
+
+/**
+ * Thread-safe write-once ``Option<T>`` for lazily initialized values such as compiled regexes or parsed configs.
+ *
+ * The value lives in raw storage and the atomic state word is its only flag: it replaces both ``std::once_flag``
+ * and the engaged flag an ``Option<T>`` would carry. Once initialized, every access is one acquire load. Callers
+ * arriving while another thread initializes block on the state word.
+ */
+template<typename T>
+class OnceOption
+{
+private:
+    std::atomic<internal::OnceState> _state{internal::OnceState::Empty};
+    alignas(T) unsigned char _storage[sizeof(T)];
+
+    /**
+     * Only valid once ``_state`` is Ready.
+     */
+    T& Value() noexcept
+    {
+        return *std::launder(reinterpret_cast<T*>(_storage));
+    }
+
+    T const& Value() const noexcept
+    {
+        return *std::launder(reinterpret_cast<T const*>(_storage));
+    }
+
+    /**
+     * Claims the right to initialize.
+     *
+     * @return ``true`` if the caller must initialize, ``false`` once another thread has published the value.
+     */
+    bool Claim() noexcept
+    {
+        while (true)
+        {
+            internal::OnceState state = internal::OnceState::Empty;
+            if (_state.compare_exchange_strong(state, internal::OnceState::Running, std::memory_order_acquire))
+                return true;
+
+            if (state == internal::OnceState::Ready) return false;
+
+            _state.wait(internal::OnceState::Running, std::memory_order_acquire);
+        }
+    }
+
+    void Release(internal::OnceState state) noexcept
+    {
+        _state.store(state, std::memory_order_release);
+        _state.notify_all();
+    }
+
+    /**
+     * Stores ``make()`` and wakes waiters; if ``make`` throws, the claim is dropped so the next caller retries.
+     */
+    template<typename Make>
+    T const& Publish(Make&& make)
+    {
+        try
+        {
+            std::construct_at(reinterpret_cast<T*>(_storage), make());
+        }
+        catch (...)
+        {
+            Release(internal::OnceState::Empty);
+            throw;
+        }
+
+        Release(internal::OnceState::Ready);
+        return std::as_const(*this).Value();
+    }
+
+public:
+#pragma region Constructors
+    OnceOption() noexcept
+    {
+    }
+
+    OnceOption(OnceOption const&) = delete;
+    OnceOption& operator=(OnceOption const&) = delete;
+
+    ~OnceOption()
+    {
+        if (IsSome()) std::destroy_at(&Value());
+    }
+#pragma endregion
+
+#pragma region Get
+    /**
+     * @return The value if initialization has completed, otherwise None. Never blocks.
+     */
+    [[nodiscard]] OptionRef<T const> Get() const noexcept
+    {
+        if (!IsSome()) return Prelude::None;
+
+        return OptionRef<T const>(Value());
+    }
+#pragma endregion
+
+#pragma region GetOrInit
+    /**
+     * Returns the value, running ``init`` to produce it if this is the first call.
+     * If ``init`` throws, the exception propagates and the next caller runs its own ``init``.
+     */
+    template<typename Init>
+        requires(std::is_constructible_v<T, std::invoke_result_t<Init&>>)
+    T const& GetOrInit(Init&& init)
+    {
+        if (IsSome() || !Claim()) return std::as_const(*this).Value();
+
+        return Publish([&]() -> decltype(auto) { return std::invoke(init); });
+    }
+#pragma endregion
+
+#pragma region GetOrTryInit
+    /**
+     * Like ``GetOrInit`` for a fallible ``init`` returning ``Result<T, E>``. An Err is returned to this caller only:
+     * nothing is published, so the next caller retries. Use ``OnceResult`` to cache the Err instead.
+     */
+    template<typename Init,
+             typename E = typename internal::ResultTraits<std::remove_cvref_t<std::invoke_result_t<Init&>>>::ErrorType>
+    Result<std::reference_wrapper<T const>, E> GetOrTryInit(Init&& init)
+    {
+        using Outcome = Result<std::reference_wrapper<T const>, E>;
+
+        if (IsSome() || !Claim()) return Outcome(OkTag, std::cref(std::as_const(*this).Value()));
+
+        Result<T, E> result = [&]
+        {
+            try
+            {
+                return std::invoke(init);
+            }
+            catch (...)
+            {
+                Release(internal::OnceState::Empty);
+                throw;
+            }
+        }();
+
+        if (result.IsErr())
+        {
+            Release(internal::OnceState::Empty);
+            return Outcome(ErrTag, internal::Unchecked::Err(std::move(result)));
+        }
+
+        T const& value = Publish([&]() -> T&& { return internal::Unchecked::Value(std::move(result)); });
+        return Outcome(OkTag, std::cref(value));
+    }
+#pragma endregion
+
+#pragma region IsSome
+    /**
+     * @return Whether initialization has completed.
+     */
+    [[nodiscard]] bool IsSome() const noexcept
+    {
+        return _state.load(std::memory_order_acquire) == internal::OnceState::Ready;
+    }
+#pragma endregion
+
+#pragma region Set
+    /**
+     * Initializes the cell with ``value`` unless it already holds one.
+     *
+     * @return Whether ``value`` was stored.
+     */
+    bool Set(T value)
+    {
+        if (IsSome() || !Claim()) return false;
+
+        Publish([&]() -> T&& { return std::move(value); });
+        return true;
+    }
+#pragma endregion
+};
+
+/**
+ * Thread-safe lazily computed ``Result<T, E>``: the first outcome of ``GetOrInit``, Ok or Err, is kept for good.
+ * For initializers whose failures should be retried, use ``OnceOption::GetOrTryInit``.
+ */
+template<typename T, typename E = std::runtime_error>
+class OnceResult
+{
+private:
+    OnceOption<Result<T, E>> _cell;
+
+public:
+#pragma region Constructors
+    OnceResult() = default;
+
+    OnceResult(OnceResult const&) = delete;
+    OnceResult& operator=(OnceResult const&) = delete;
+#pragma endregion
+
+#pragma region Get
+    /**
+     * @return The outcome if initialization has completed, otherwise None. Never blocks.
+     */
+    [[nodiscard]] OptionRef<Result<T, E> const> Get() const noexcept
+    {
+        return _cell.Get();
+    }
+#pragma endregion
+
+#pragma region GetOrInit
+    /**
+     * Returns the outcome, running ``init`` to produce it if this is the first call.
+     * If ``init`` throws, the exception propagates and the next caller runs its own ``init``.
+     */
+    template<typename Init>
+        requires(std::is_convertible_v<std::invoke_result_t<Init&>, Result<T, E>>)
+    Result<T, E> const& GetOrInit(Init&& init)
+    {
+        return _cell.GetOrInit(std::forward<Init>(init));
+    }
+#pragma endregion
+
+#pragma region IsSome
+    /**
+     * @return Whether initialization has completed.
+     */
+    [[nodiscard]] bool IsSome() const noexcept
+    {
+        return _cell.IsSome();
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // ONCE_OPTION_H
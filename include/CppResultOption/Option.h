@@ -12,7 +12,12 @@
 #include "SomeExpectedException.h"
 
 #include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
 #include <optional>
+#include <span>
+#include <type_traits>
 
 namespace m24
 {
@@ -25,6 +30,8 @@ namespace internal
     private:
         std::optional<T> _value;
 
+        friend struct Unchecked;
+
     public:
 #pragma region Constructors
         explicit OptionBase(T const& value)
@@ -43,7 +50,21 @@ namespace internal
         {
         }
 
-        // TODO: assignment operator (maybe copy-and-swap)
+        explicit OptionBase(std::optional<T> const& value)
+            : _value(value)
+        {
+        }
+
+        explicit OptionBase(std::optional<T>&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+            : _value(std::move(value))
+        {
+        }
+
+        // Declared explicitly: the virtual destructor would otherwise suppress the implicit moves.
+        OptionBase(OptionBase const&) = default;
+        OptionBase(OptionBase&&) noexcept(std::is_nothrow_move_constructible_v<T>) = default;
+        OptionBase& operator=(OptionBase const&) = default;
+        OptionBase& operator=(OptionBase&&) noexcept(std::is_nothrow_move_assignable_v<T>) = default;
 
         virtual ~OptionBase() = default;
 #pragma endregion
@@ -131,6 +152,65 @@ namespace internal
         }
 #pragma endregion
 
+#pragma region Iter
+        // An Option is a contiguous range of zero or one element, so ``for (auto& v : option)``,
+        // the standard algorithms and ``std::views::join`` work on it directly.
+
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = T const*;
+
+        T* data() noexcept
+        {
+            return IsSome() ? _value.operator->() : nullptr;
+        }
+
+        T const* data() const noexcept
+        {
+            return IsSome() ? _value.operator->() : nullptr;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return IsSome() ? 1 : 0;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return IsNone();
+        }
+
+        T* begin() noexcept
+        {
+            return data();
+        }
+
+        T const* begin() const noexcept
+        {
+            return data();
+        }
+
+        T* end() noexcept
+        {
+            return data() + size();
+        }
+
+        T const* end() const noexcept
+        {
+            return data() + size();
+        }
+
+        std::span<T const> Iter() const noexcept
+        {
+            return {data(), size()};
+        }
+
+        std::span<T> IterMut() noexcept
+        {
+            return {data(), size()};
+        }
+#pragma endregion
+
 #pragma region Map
         template<typename R, typename Functor>
         Option<R> Map(Functor&& functor) const noexcept
@@ -223,6 +303,31 @@ namespace internal
         }
 #pragma endregion
 
+#pragma region Std
+        /**
+         * @return The underlying ``std::optional`` itself: Option stores one, so this is a view, not a conversion.
+         */
+        [[nodiscard]] std::optional<T> const& AsStd() const& noexcept
+        {
+            return _value;
+        }
+
+        [[nodiscard]] std::optional<T>& AsStd() & noexcept
+        {
+            return _value;
+        }
+
+        [[nodiscard]] std::optional<T> ToStd() const&
+        {
+            return _value;
+        }
+
+        [[nodiscard]] std::optional<T> ToStd() && noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            return std::move(_value);
+        }
+#pragma endregion
+
 #pragma region Take
         Option<T> Take() noexcept
         {
@@ -346,6 +451,7 @@ namespace internal
         }
 
         explicit operator T() const
+            requires(!std::same_as<T, bool>)
         {
             return Unwrap();
         }
@@ -393,6 +499,19 @@ namespace internal
         {
             return IsSome();
         }
+
+        /**
+         * Orders None before every Some and compares Some values by ``T``'s ordering.
+         * Use ``OptionLess`` to place None last instead.
+         */
+        auto operator<=>(Option<T> const& other) const noexcept
+            requires(std::three_way_comparable<T>)
+        {
+            using Ordering = std::compare_three_way_result_t<T>;
+
+            if (IsNone() || other.IsNone()) return Ordering(IsSome() <=> other.IsSome());
+            return Ordering(UnwrapUnchecked() <=> other.UnwrapUnchecked());
+        }
 #pragma endregion
     };
 }
@@ -416,10 +535,59 @@ public:
         : internal::OptionBase<T>()
     {
     }
+
+    explicit Option(std::optional<T> const& value)
+        : internal::OptionBase<T>(value)
+    {
+    }
+
+    explicit Option(std::optional<T>&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : internal::OptionBase<T>(std::move(value))
+    {
+    }
 };
 
+/**
+ * Adopts a ``std::optional``, moving its value when given an rvalue.
+ */
+template<typename T>
+Option<T> FromStd(std::optional<T> const& value)
+{
+    return Option<T>(value);
+}
+
+template<typename T>
+Option<T> FromStd(std::optional<T>&& value) noexcept(std::is_nothrow_move_constructible_v<T>)
+{
+    return Option<T>(std::move(value));
+}
+
 // TODO: implement Option<Option<T>>
 
+enum class NonePlacement
+{
+    First,
+    Last,
+};
+
+/**
+ * Strict weak ordering for sorting Options with a chosen None placement.
+ * Some values are compared with ``operator<``.
+ */
+template<NonePlacement Placement = NonePlacement::Last>
+struct OptionLess
+{
+    template<typename T>
+    bool operator()(Option<T> const& lhs, Option<T> const& rhs) const
+    {
+        if (lhs.IsSome() != rhs.IsSome()) return (Placement == NonePlacement::First) == rhs.IsSome();
+        return lhs.IsSome() && *lhs < *rhs;
+    }
+};
+
 } // namespace m24
 
+#define M24_OPTION_COMPLETE
+#include "ExternTemplates.h"
+
 #endif // OPTION_H
@@ -8,6 +8,9 @@
 #include "Option.h"
 #include "OptionNone.h"
 
+#include <type_traits>
+#include <utility>
+
 namespace m24::Prelude
 {
 
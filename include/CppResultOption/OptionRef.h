@@ -0,0 +1,187 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef OPTION_REF_H
+#define OPTION_REF_H
+
+#include "Option.h"
+#include "OptionNone.h"
+#include "OptionPrelude.h"
+#include "SomeExpectedException.h"
+
+#include <type_traits>
+
+namespace m24
+{
+
+/**
+ * Non-owning, pointer-backed ``Option<T&>``: either refers to a value stored elsewhere or is None.
+ * Used wherever a container hands out optional access to an element without copying it.
+ */
+template<typename T>
+class OptionRef
+{
+private:
+    T* _value;
+
+public:
+    using ValueType = std::remove_const_t<T>;
+
+#pragma region Constructors
+    OptionRef() noexcept
+        : _value(nullptr)
+    {
+    }
+
+    OptionRef(Prelude::OptionNone const&) noexcept
+        : _value(nullptr)
+    {
+    }
+
+    explicit OptionRef(T& value) noexcept
+        : _value(&value)
+    {
+    }
+
+    /**
+     * @param value Pointer to the referenced value, ``nullptr`` for None.
+     */
+    static OptionRef FromPointer(T* value) noexcept
+    {
+        OptionRef result;
+        result._value = value;
+        return result;
+    }
+#pragma endregion
+
+#pragma region IsNone
+    [[nodiscard]] bool IsNone() const noexcept
+    {
+        return _value == nullptr;
+    }
+
+    template<typename Predicate>
+    [[nodiscard]] bool IsNoneOr(Predicate predicate) const
+    {
+        if (IsNone()) return true;
+
+        return predicate(*_value);
+    }
+#pragma endregion
+
+#pragma region IsSome
+    [[nodiscard]] bool IsSome() const noexcept
+    {
+        return _value != nullptr;
+    }
+
+    template<typename Predicate>
+    [[nodiscard]] bool IsSomeAnd(Predicate predicate) const
+    {
+        if (IsNone()) return false;
+
+        return predicate(*_value);
+    }
+#pragma endregion
+
+#pragma region Expect
+    T& Expect(std::string const& message) const
+    {
+        if (IsNone()) throw SomeExpectedException(message);
+
+        return *_value;
+    }
+#pragma endregion
+
+#pragma region Map
+    template<typename R, typename Functor>
+    Option<R> Map(Functor&& functor) const
+    {
+        if (IsNone()) return Prelude::None;
+
+        return Prelude::Some(functor(*_value));
+    }
+#pragma endregion
+
+#pragma region Cloned
+    /**
+     * @return Copy of the referenced value as an owning Option.
+     */
+    Option<ValueType> Cloned() const
+    {
+        if (IsNone()) return Prelude::None;
+
+        return Option<ValueType>(*_value);
+    }
+#pragma endregion
+
+#pragma region Unwrap
+    T& Unwrap() const
+    {
+        if (IsNone()) throw SomeExpectedException();
+
+        return *_value;
+    }
+
+    T const& UnwrapOr(ValueType const& defaultValue) const noexcept
+    {
+        if (IsNone()) return defaultValue;
+
+        return *_value;
+    }
+
+    /**
+     * @return Pointer to the referenced value, ``nullptr`` for None.
+     */
+    T* Get() const noexcept
+    {
+        return _value;
+    }
+#pragma endregion
+
+#pragma region Operators
+    T& operator*() const
+    {
+        return Unwrap();
+    }
+
+    T* operator->() const
+    {
+        return &Unwrap();
+    }
+
+    operator bool() const noexcept
+    {
+        return IsSome();
+    }
+
+    operator OptionRef<T const>() const noexcept
+        requires(!std::is_const_v<T>)
+    {
+        return OptionRef<T const>::FromPointer(_value);
+    }
+
+    template<typename U>
+    bool operator==(OptionRef<U> const& other) const
+    {
+        if (IsNone() || other.IsNone()) return IsNone() == other.IsNone();
+        return *_value == *other.Get();
+    }
+
+    bool operator==(Option<ValueType> const& other) const
+    {
+        if (IsNone() || other.IsNone()) return IsNone() == other.IsNone();
+        return *_value == *other;
+    }
+
+    bool operator==(Prelude::OptionNone const&) const noexcept
+    {
+        return IsNone();
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // OPTION_REF_H
@@ -0,0 +1,323 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef OPTION_VECTOR_H
+#define OPTION_VECTOR_H
+
+#include "MaskedRange.h"
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "OptionRef.h"
+#include "ValidityBitmap.h"
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace m24
+{
+
+/**
+ * Columnar replacement for ``std::vector<Option<T>>``: a dense value array plus a packed validity bitmap.
+ * None slots hold a value-initialized ``T`` so the value column stays contiguous and scannable.
+ */
+template<typename T>
+class OptionVector
+{
+    static_assert(std::is_default_constructible_v<T>, "OptionVector<T> requires a default constructible T");
+    static_assert(!std::is_same_v<T, bool>, "OptionVector<bool> would sit on the bit-packed std::vector<bool>");
+
+private:
+    std::vector<T> _values;
+    ValidityBitmap _validity;
+
+#pragma region Iterators
+    template<bool Const>
+    class Iterator
+    {
+    private:
+        using Vector = std::conditional_t<Const, OptionVector const, OptionVector>;
+
+        Vector* _vector = nullptr;
+        std::size_t _index = 0;
+
+    public:
+        using value_type = OptionRef<std::conditional_t<Const, T const, T>>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_concept = std::forward_iterator_tag;
+
+        Iterator() = default;
+
+        Iterator(Vector* vector, std::size_t index)
+            : _vector(vector),
+              _index(index)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*_vector)[_index];
+        }
+
+        Iterator& operator++()
+        {
+            ++_index;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator result = *this;
+            ++_index;
+            return result;
+        }
+
+        bool operator==(Iterator const& other) const = default;
+    };
+#pragma endregion
+
+public:
+    using value_type = Option<T>;
+    using size_type = std::size_t;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+#pragma region Constructors
+    OptionVector() = default;
+
+    /**
+     * @param size Number of elements, all None.
+     */
+    explicit OptionVector(std::size_t size)
+        : _values(size),
+          _validity(size)
+    {
+    }
+
+    /**
+     * Adopts an existing value column and validity bitmap of the same length.
+     * None slots are expected to hold a value-initialized ``T``.
+     */
+    OptionVector(std::vector<T> values, ValidityBitmap validity)
+        : _values(std::move(values)),
+          _validity(std::move(validity))
+    {
+        assert(_values.size() == _validity.size());
+    }
+
+    OptionVector(std::initializer_list<Option<T>> options)
+    {
+        reserve(options.size());
+        for (Option<T> const& option : options) push_back(option);
+    }
+#pragma endregion
+
+#pragma region Capacity
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _values.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _values.empty();
+    }
+
+    void reserve(std::size_t size)
+    {
+        _values.reserve(size);
+        _validity.reserve(size);
+    }
+
+    void clear() noexcept
+    {
+        _values.clear();
+        _validity.clear();
+    }
+#pragma endregion
+
+#pragma region Modifiers
+    void push_back(Option<T> const& option)
+    {
+        if (option.IsNone())
+        {
+            PushNone();
+            return;
+        }
+
+        _values.push_back(*option);
+        _validity.push_back(true);
+    }
+
+    void push_back(Option<T>&& option)
+    {
+        if (option.IsNone())
+        {
+            PushNone();
+            return;
+        }
+
+        _values.push_back(std::move(option).Unwrap());
+        _validity.push_back(true);
+    }
+
+    void push_back(T const& value)
+    {
+        _values.push_back(value);
+        _validity.push_back(true);
+    }
+
+    void push_back(T&& value)
+    {
+        _values.push_back(std::move(value));
+        _validity.push_back(true);
+    }
+
+    void PushNone()
+    {
+        _values.emplace_back();
+        _validity.push_back(false);
+    }
+
+    void Set(std::size_t index, T const& value)
+    {
+        _values[index] = value;
+        _validity.Set(index);
+    }
+
+    void Set(std::size_t index, T&& value)
+    {
+        _values[index] = std::move(value);
+        _validity.Set(index);
+    }
+
+    /**
+     * Moves the value at ``index`` out and leaves None in its place, mirroring ``Option::Take``.
+     */
+    Option<T> Take(std::size_t index)
+    {
+        if (!_validity.Test(index)) return Prelude::None;
+
+        Option<T> result = Prelude::Some(std::move(_values[index]));
+        _values[index] = T{};
+        _validity.Reset(index);
+
+        return result;
+    }
+#pragma endregion
+
+#pragma region Access
+    OptionRef<T> operator[](std::size_t index) noexcept
+    {
+        return OptionRef<T>::FromPointer(_validity.Test(index) ? &_values[index] : nullptr);
+    }
+
+    OptionRef<T const> operator[](std::size_t index) const noexcept
+    {
+        return OptionRef<T const>::FromPointer(_validity.Test(index) ? &_values[index] : nullptr);
+    }
+
+    [[nodiscard]] bool IsSome(std::size_t index) const noexcept
+    {
+        return _validity.Test(index);
+    }
+
+    [[nodiscard]] bool IsNone(std::size_t index) const noexcept
+    {
+        return !_validity.Test(index);
+    }
+
+    /**
+     * @return The dense value column, including the placeholder values of None slots.
+     */
+    [[nodiscard]] std::span<T const> Values() const noexcept
+    {
+        return _values;
+    }
+
+    [[nodiscard]] ValidityBitmap const& Validity() const noexcept
+    {
+        return _validity;
+    }
+#pragma endregion
+
+#pragma region Count
+    [[nodiscard]] std::size_t CountSome() const noexcept
+    {
+        return _validity.Count();
+    }
+
+    [[nodiscard]] std::size_t CountNone() const noexcept
+    {
+        return size() - CountSome();
+    }
+#pragma endregion
+
+#pragma region Iteration
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(this, size());
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, size());
+    }
+
+    /**
+     * @return Range over the Some values only; runs of None are skipped a bitmap word at a time.
+     */
+    internal::MaskedRange<T> Somes() noexcept
+    {
+        return internal::MaskedRange<T>(_validity, _values.data());
+    }
+
+    internal::MaskedRange<T const> Somes() const noexcept
+    {
+        return internal::MaskedRange<T const>(_validity, _values.data());
+    }
+
+    /**
+     * Calls ``action(index, value)`` for every Some element in index order.
+     */
+    template<typename Action>
+    void ForEachSome(Action&& action) const
+    {
+        for (std::size_t i = _validity.FindNext(0); i < size(); i = _validity.FindNext(i + 1)) action(i, _values[i]);
+    }
+#pragma endregion
+
+#pragma region Operators
+    bool operator==(OptionVector const& other) const
+    {
+        if (_validity != other._validity) return false;
+
+        for (std::size_t i = _validity.FindNext(0); i < size(); i = _validity.FindNext(i + 1))
+        {
+            if (!(_values[i] == other._values[i])) return false;
+        }
+
+        return true;
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // OPTION_VECTOR_H
@@ -0,0 +1,29 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef OVERFLOW_ERROR_H
+#define OVERFLOW_ERROR_H
+
+#include <stdexcept>
+
+namespace m24
+{
+
+class OverflowError : public std::overflow_error
+{
+public:
+    OverflowError()
+        : std::overflow_error("Arithmetic overflow")
+    {
+    }
+
+    OverflowError(std::string const& message)
+        : std::overflow_error(message)
+    {
+    }
+};
+
+} // namespace m24
+
+#endif // OVERFLOW_ERROR_H
@@ -0,0 +1,201 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "Result.h"
+#include "ThreadPool.h"
+#include "Unchecked.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace m24
+{
+
+/**
+ * Execution settings for the ``Parallel*`` algorithms.
+ */
+struct ParallelPolicy
+{
+    /// Pool the chunks run on; ``nullptr`` means ``ThreadPool::Default()``.
+    ThreadPool* pool = nullptr;
+
+    /// Number of participants including the calling thread; 0 means the pool's size.
+    std::size_t threads = 0;
+
+    /// Elements per work item; 0 picks a size giving each thread about 16 chunks.
+    std::size_t chunkSize = 0;
+};
+
+inline constexpr ParallelPolicy Par{};
+
+namespace internal
+{
+    inline std::size_t ResolveThreads(ParallelPolicy const& policy, ThreadPool const& pool) noexcept
+    {
+        return std::max<std::size_t>(1, policy.threads != 0 ? policy.threads : pool.size());
+    }
+
+    inline std::size_t ResolveChunkSize(ParallelPolicy const& policy, std::size_t threads, std::size_t size) noexcept
+    {
+        if (policy.chunkSize != 0) return policy.chunkSize;
+
+        return std::max<std::size_t>(1, size / (threads * 16));
+    }
+
+    /**
+     * Lowers ``target`` to ``value`` if it is smaller.
+     */
+    inline void AtomicMin(std::atomic<std::size_t>& target, std::size_t value) noexcept
+    {
+        std::size_t current = target.load(std::memory_order_relaxed);
+        while (value < current && !target.compare_exchange_weak(current, value, std::memory_order_release,
+                                                                std::memory_order_relaxed))
+        {
+        }
+    }
+} // namespace internal
+
+#pragma region ParallelTryTransform
+/**
+ * Applies the fallible ``functor`` to every element of ``range``: the calling thread plus ``policy.threads - 1``
+ * jobs posted to ``policy.pool``. The caller then helps run queued pool jobs until its own have finished, so no
+ * thread is created per call and calling it from inside a pool job does not tie up a worker.
+ *
+ * Work is handed out in index order as chunks from a shared atomic cursor. A failing element publishes its index
+ * through an atomic minimum, and workers stop at their next chunk boundary once every remaining chunk lies past it.
+ * Chunks before the lowest failing index are always completed, so the returned Err is deterministically the one
+ * a sequential loop would have hit first. An exception thrown by ``functor`` is rethrown on the calling thread.
+ *
+ * @return ``Ok`` with the mapped values in input order, or the Err of the lowest failing index.
+ */
+template<std::ranges::random_access_range Range, typename Functor>
+    requires(std::ranges::sized_range<Range> &&
+             internal::ResultLike<std::invoke_result_t<Functor&, std::ranges::range_reference_t<Range>>>)
+auto ParallelTryTransform(ParallelPolicy const& policy, Range&& range, Functor&& functor)
+{
+    using Mapped = std::remove_cvref_t<std::invoke_result_t<Functor&, std::ranges::range_reference_t<Range>>>;
+    using R = typename internal::ResultTraits<Mapped>::ValueType;
+    using E = typename internal::ResultTraits<Mapped>::ErrorType;
+    // std::vector<bool> packs bits, so concurrent writes to neighbouring slots would race.
+    using Slot =
+        std::conditional_t<std::is_default_constructible_v<R> && !std::is_same_v<R, bool>, R, std::optional<R>>;
+
+    ThreadPool& pool = policy.pool != nullptr ? *policy.pool : ThreadPool::Default();
+
+    std::size_t const participants = internal::ResolveThreads(policy, pool);
+
+    std::size_t const size = static_cast<std::size_t>(std::ranges::size(range));
+    std::size_t const chunkSize = internal::ResolveChunkSize(policy, participants, size);
+    std::size_t const chunkCount = (size + chunkSize - 1) / chunkSize;
+    std::size_t const threads = std::min(participants, std::max<std::size_t>(chunkCount, 1));
+
+    std::vector<Slot> slots(size);
+    std::vector<std::optional<E>> chunkErrors(chunkCount);
+
+    std::atomic<std::size_t> nextChunk{0};
+    std::atomic<std::size_t> firstErrorChunk{std::numeric_limits<std::size_t>::max()};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    auto first = std::ranges::begin(range);
+
+    auto work = [&]
+    {
+        try
+        {
+            while (true)
+            {
+                std::size_t const chunk = nextChunk.fetch_add(1, std::memory_order_relaxed);
+                if (chunk >= chunkCount || chunk > firstErrorChunk.load(std::memory_order_acquire)) return;
+
+                std::size_t const end = std::min(size, (chunk + 1) * chunkSize);
+                for (std::size_t i = chunk * chunkSize; i < end; ++i)
+                {
+                    Mapped mapped = functor(first[static_cast<std::ranges::range_difference_t<Range>>(i)]);
+                    if (mapped.IsErr())
+                    {
+                        chunkErrors[chunk].emplace(internal::Unchecked::Err(std::move(mapped)));
+                        internal::AtomicMin(firstErrorChunk, chunk);
+                        break;
+                    }
+
+                    slots[i] = internal::Unchecked::Value(std::move(mapped));
+                }
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard lock(exceptionMutex);
+            if (!exception) exception = std::current_exception();
+            internal::AtomicMin(firstErrorChunk, 0);
+        }
+    };
+
+    // Shared so that the last job's decrement and notify never touch this frame after the caller has returned.
+    auto pending = std::make_shared<std::atomic<std::size_t>>(threads - 1);
+    for (std::size_t t = 1; t < threads; ++t)
+        pool.Post(
+            [&work, pending]
+            {
+                work();
+                if (pending->fetch_sub(1, std::memory_order_acq_rel) == 1) pending->notify_all();
+            });
+
+    work();
+
+    for (std::size_t left = pending->load(std::memory_order_acquire); left != 0;
+         left = pending->load(std::memory_order_acquire))
+    {
+        if (pool.RunOne()) continue;
+
+        if (pool.InWorker())
+            std::this_thread::yield();
+        else
+            pending->wait(left, std::memory_order_acquire);
+    }
+
+    if (exception) std::rethrow_exception(exception);
+
+    std::size_t const errorChunk = firstErrorChunk.load(std::memory_order_acquire);
+    if (errorChunk != std::numeric_limits<std::size_t>::max())
+        return Result<std::vector<R>, E>(ErrTag, std::move(*chunkErrors[errorChunk]));
+
+    if constexpr (std::is_same_v<Slot, R>)
+    {
+        return Result<std::vector<R>, E>(OkTag, std::move(slots));
+    }
+    else
+    {
+        std::vector<R> values;
+        values.reserve(size);
+        for (Slot& slot : slots) values.push_back(std::move(*slot));
+        return Result<std::vector<R>, E>(OkTag, std::move(values));
+    }
+}
+
+template<std::ranges::random_access_range Range, typename Functor>
+    requires(std::ranges::sized_range<Range>)
+auto ParallelTryTransform(Range&& range, Functor&& functor)
+{
+    return ParallelTryTransform(Par, std::forward<Range>(range), std::forward<Functor>(functor));
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // PARALLEL_H
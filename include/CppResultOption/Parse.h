@@ -0,0 +1,295 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef PARSE_H
+#define PARSE_H
+
+#include "Option.h"
+#include "OptionPrelude.h"
+#include "Result.h"
+#include "Unchecked.h"
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace m24
+{
+
+enum class ParseReason
+{
+    Empty,
+    InvalidCharacter,
+    OutOfRange,
+    /// A valid prefix followed by more input.
+    TrailingCharacters,
+    /// ``ParseInteger`` was given a base outside 2 to 36.
+    InvalidBase,
+};
+
+/**
+ * Why and where parsing stopped; ``position`` is an offset into the input.
+ */
+struct ParseError
+{
+    ParseReason reason;
+    std::size_t position = 0;
+
+    bool operator==(ParseError const&) const = default;
+};
+
+template<typename T>
+concept ParsableNumber = (std::integral<T> && !std::same_as<T, bool>) || std::floating_point<T>;
+
+namespace internal
+{
+    /**
+     * Shared tail of every ``from_chars`` call: maps its error code and checks that the whole input was consumed.
+     */
+    template<typename T>
+    Result<T, ParseError> FinishParse(std::string_view text, std::size_t offset, std::from_chars_result parsed,
+                                      T value) noexcept
+    {
+        using Parsed = Result<T, ParseError>;
+
+        std::size_t const end = static_cast<std::size_t>(parsed.ptr - text.data());
+        if (parsed.ec == std::errc::invalid_argument)
+            return Parsed(ErrTag, ParseError{ParseReason::InvalidCharacter, offset});
+        if (parsed.ec == std::errc::result_out_of_range)
+            return Parsed(ErrTag, ParseError{ParseReason::OutOfRange, offset});
+        if (end != text.size()) return Parsed(ErrTag, ParseError{ParseReason::TrailingCharacters, end});
+
+        return Parsed(OkTag, value);
+    }
+
+    /**
+     * ``from_chars`` rejects a leading ``+``; accept one, but not ``+-``.
+     */
+    inline std::size_t SkipPlus(std::string_view text) noexcept
+    {
+        return text.size() > 1 && text[0] == '+' && text[1] != '-' && text[1] != '+' ? 1 : 0;
+    }
+} // namespace internal
+
+#pragma region Parse
+/**
+ * Parses an integer in ``base`` (2 to 36) from the whole of ``text``. Never allocates or throws.
+ */
+template<std::integral T>
+    requires(!std::same_as<T, bool>)
+Result<T, ParseError> ParseInteger(std::string_view text, int base = 10) noexcept
+{
+    if (base < 2 || base > 36) return Result<T, ParseError>(ErrTag, ParseError{ParseReason::InvalidBase, 0});
+    if (text.empty()) return Result<T, ParseError>(ErrTag, ParseError{ParseReason::Empty, 0});
+
+    std::size_t const offset = internal::SkipPlus(text);
+    T value{};
+    std::from_chars_result const parsed = std::from_chars(text.data() + offset, text.data() + text.size(), value, base);
+
+    return internal::FinishParse(text, offset, parsed, value);
+}
+
+/**
+ * Parses hexadecimal digits, with or without a ``0x``/``0X`` prefix. A sign is only accepted before an unprefixed
+ * number: ``0x-5`` is an error, as it is for ``strtol``.
+ */
+template<std::integral T>
+    requires(!std::same_as<T, bool>)
+Result<T, ParseError> ParseHex(std::string_view text) noexcept
+{
+    bool const prefixed = text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X');
+    if (!prefixed) return ParseInteger<T>(text, 16);
+    if (text[2] == '+' || text[2] == '-')
+        return Result<T, ParseError>(ErrTag, ParseError{ParseReason::InvalidCharacter, 2});
+
+    Result<T, ParseError> parsed = ParseInteger<T>(text.substr(2), 16);
+    if (parsed.IsErr()) internal::Unchecked::Err(parsed).position += 2;
+
+    return parsed;
+}
+
+/**
+ * Parses the whole of ``text`` as ``T``: base-10 integers, or floating point in fixed or scientific notation
+ * (plus ``inf``/``nan``). A leading ``+`` is accepted. Never allocates or throws.
+ */
+template<ParsableNumber T>
+Result<T, ParseError> Parse(std::string_view text) noexcept
+{
+    if constexpr (std::integral<T>)
+    {
+        return ParseInteger<T>(text);
+    }
+    else
+    {
+        if (text.empty()) return Result<T, ParseError>(ErrTag, ParseError{ParseReason::Empty, 0});
+
+        std::size_t const offset = internal::SkipPlus(text);
+        T value{};
+        std::from_chars_result const parsed = std::from_chars(text.data() + offset, text.data() + text.size(), value);
+
+        return internal::FinishParse(text, offset, parsed, value);
+    }
+}
+
+/**
+ * Accepts exactly ``true``, ``false``, ``1`` or ``0``.
+ */
+inline Result<bool, ParseError> ParseBool(std::string_view text) noexcept
+{
+    using Parsed = Result<bool, ParseError>;
+
+    if (text.empty()) return Parsed(ErrTag, ParseError{ParseReason::Empty, 0});
+    if (text == "true" || text == "1") return Parsed(OkTag, true);
+    if (text == "false" || text == "0") return Parsed(OkTag, false);
+
+    return Parsed(ErrTag, ParseError{ParseReason::InvalidCharacter, 0});
+}
+#pragma endregion
+
+#pragma region ParseColumn
+/**
+ * Parses each element of ``input`` into the matching slot of ``output`` (which must be at least as long); failed
+ * and empty elements become None.
+ *
+ * @return The number of non-empty elements that failed to parse.
+ */
+template<ParsableNumber T>
+std::size_t ParseColumn(std::span<std::string_view const> input, std::span<Option<T>> output) noexcept
+{
+    std::size_t failed = 0;
+
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        Result<T, ParseError> parsed = Parse<T>(input[i]);
+        if (parsed.IsOk())
+        {
+            internal::Unchecked::Emplace(output[i], internal::Unchecked::Value(parsed));
+            continue;
+        }
+
+        output[i] = Option<T>();
+        if (internal::Unchecked::Err(parsed).reason != ParseReason::Empty) ++failed;
+    }
+
+    return failed;
+}
+#pragma endregion
+
+#pragma region SplitFields
+/**
+ * Lazily splits a line on a delimiter, yielding ``Option<std::string_view>`` per field: None for an empty field,
+ * otherwise a view into the line. ``n`` delimiters always give ``n + 1`` fields.
+ */
+class SplitFields
+{
+private:
+    std::string_view _line;
+    char _delimiter;
+
+public:
+    class Iterator
+    {
+    private:
+        std::string_view _rest;
+        std::string_view _field;
+        char _delimiter = ',';
+        bool _last = false;
+        bool _done = true;
+
+        void Advance() noexcept
+        {
+            std::size_t const end = _rest.find(_delimiter);
+            if (end == std::string_view::npos)
+            {
+                _field = _rest;
+                _rest = std::string_view();
+                _last = true;
+                return;
+            }
+
+            _field = _rest.substr(0, end);
+            _rest = _rest.substr(end + 1);
+        }
+
+    public:
+        using value_type = Option<std::string_view>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        Iterator(std::string_view line, char delimiter) noexcept
+            : _rest(line),
+              _delimiter(delimiter),
+              _done(false)
+        {
+            Advance();
+        }
+
+        value_type operator*() const noexcept
+        {
+            if (_field.empty()) return Prelude::None;
+
+            return Option<std::string_view>(_field);
+        }
+
+        Iterator& operator++() noexcept
+        {
+            if (_last)
+                _done = true;
+            else
+                Advance();
+
+            return *this;
+        }
+
+        Iterator operator++(int) noexcept
+        {
+            Iterator result = *this;
+            ++*this;
+            return result;
+        }
+
+        bool operator==(std::default_sentinel_t) const noexcept
+        {
+            return _done;
+        }
+    };
+
+    SplitFields(std::string_view line, char delimiter) noexcept
+        : _line(line),
+          _delimiter(delimiter)
+    {
+    }
+
+    Iterator begin() const noexcept
+    {
+        return Iterator(_line, _delimiter);
+    }
+
+    std::default_sentinel_t end() const noexcept
+    {
+        return std::default_sentinel;
+    }
+
+    /**
+     * @return Field ``index``, or None if it is empty or the line has fewer fields.
+     */
+    [[nodiscard]] Option<std::string_view> operator[](std::size_t index) const noexcept
+    {
+        for (Iterator it = begin(); it != end(); ++it, --index)
+            if (index == 0) return *it;
+
+        return Prelude::None;
+    }
+};
+#pragma endregion
+
+} // namespace m24
+
+#endif // PARSE_H
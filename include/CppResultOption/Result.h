@@ -6,9 +6,16 @@
 #define RESULT2_H
 
 #include <cassert>
-#include <iostream>
+#include <concepts>
 #include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <version>
+
+#ifdef __cpp_lib_expected
+#include <expected>
+#endif
 
 #include "ErrExpectedException.h"
 #include "OkExpectedException.h"
@@ -30,6 +37,8 @@ namespace internal
         std::optional<T> _okValue;
         std::optional<E> _errValue;
 
+        friend struct Unchecked;
+
     public:
 #pragma region Constructors
         ResultBase(ResultOkTag const&, T const& value)
@@ -57,6 +66,24 @@ namespace internal
               _errValue(std::move(value))
         {
         }
+
+#ifdef __cpp_lib_expected
+        explicit ResultBase(std::expected<T, E> const& value)
+        {
+            if (value.has_value())
+                _okValue.emplace(*value);
+            else
+                _errValue.emplace(value.error());
+        }
+
+        explicit ResultBase(std::expected<T, E>&& value)
+        {
+            if (value.has_value())
+                _okValue.emplace(std::move(*value));
+            else
+                _errValue.emplace(std::move(value.error()));
+        }
+#endif
 #pragma endregion
 
 #pragma region And
@@ -128,7 +155,7 @@ namespace internal
         {
             if (IsErr()) throw OkExpectedException(message);
 
-            return UnwrapUnchecked();
+            return *_okValue;
         }
 
         T Expect(std::string const& message) &&
@@ -149,7 +176,7 @@ namespace internal
         {
             if (IsOk()) throw ErrExpectedException(message);
 
-            return UnwrapErrUnchecked();
+            return *_errValue;
         }
 
         E ExpectErr(std::string const& message) &&
@@ -187,6 +214,25 @@ namespace internal
         }
 #pragma endregion
 
+#pragma region Iter
+        /**
+         * @return View of the Ok value as a contiguous range of zero or one element, aliasing the stored value.
+         */
+        std::span<T const> Iter() const noexcept
+        {
+            if (IsErr()) return {};
+
+            return {_okValue.operator->(), 1};
+        }
+
+        std::span<T> IterMut() noexcept
+        {
+            if (IsErr()) return {};
+
+            return {_okValue.operator->(), 1};
+        }
+#pragma endregion
+
 #pragma region Map
         template<typename R, typename Functor>
         Result<R, E> Map(Functor&& mapOk) const
@@ -296,6 +342,28 @@ namespace internal
         }
 #pragma endregion
 
+#pragma region Std
+#ifdef __cpp_lib_expected
+        /**
+         * Result keeps its two sides in separate storage, so unlike ``Option::AsStd`` this always builds a new
+         * ``std::expected``; call it on an rvalue to move the payload across.
+         */
+        [[nodiscard]] std::expected<T, E> ToStd() const&
+        {
+            if (IsOk()) return std::expected<T, E>(std::in_place, *_okValue);
+
+            return std::expected<T, E>(std::unexpect, *_errValue);
+        }
+
+        [[nodiscard]] std::expected<T, E> ToStd() &&
+        {
+            if (IsOk()) return std::expected<T, E>(std::in_place, std::move(*_okValue));
+
+            return std::expected<T, E>(std::unexpect, std::move(*_errValue));
+        }
+#endif
+#pragma endregion
+
 #pragma region Unwrap
         T const& Unwrap() const&
         {
@@ -395,6 +463,7 @@ namespace internal
         }
 
         explicit operator T() const
+            requires(!std::same_as<T, bool>)
         {
             return Unwrap();
         }
@@ -411,10 +480,13 @@ namespace internal
 
         Result<T, E> operator|(Result<T, E> const& other) const noexcept
         {
-            return Or(other);
+            if (IsErr()) return other;
+
+            return static_cast<Result<T, E> const&>(*this);
         }
 
         bool operator==(Result<T, E> const& other) const noexcept
+            requires(std::equality_comparable<T> && std::equality_comparable<E>)
         {
             if (IsOk() && other.IsErr() || IsErr() && other.IsOk()) return false;
             if (IsOk()) return Unwrap() == other.Unwrap();
@@ -422,28 +494,13 @@ namespace internal
         }
 
         bool operator!=(Result<T, E> const& other) const noexcept
+            requires(std::equality_comparable<T> && std::equality_comparable<E>)
         {
             if (IsOk() && other.IsErr() || IsErr() && other.IsOk()) return true;
             if (IsOk()) return Unwrap() != other.Unwrap();
             return UnwrapErr() != other.UnwrapErr();
         }
 #pragma endregion
-
-#pragma region std::cout.operator<<
-        friend std::ostream& operator<<(std::ostream& os, ResultBase const& result)
-        {
-            if (result.IsOk())
-            {
-                os << "Ok(" << result.UnwrapUnchecked() << ")";
-            }
-            else
-            {
-                os << "Err(" << result.UnwrapErrUnchecked() << ")";
-            }
-
-            return os;
-        }
-#pragma endregion
     };
 } // namespace internal
 
@@ -473,6 +530,18 @@ public:
         : internal::ResultBase<T, E>(tag, std::move(err))
     {
     }
+
+#ifdef __cpp_lib_expected
+    explicit Result(std::expected<T, E> const& value)
+        : internal::ResultBase<T, E>(value)
+    {
+    }
+
+    explicit Result(std::expected<T, E>&& value)
+        : internal::ResultBase<T, E>(std::move(value))
+    {
+    }
+#endif
 #pragma endregion
 };
 
@@ -482,6 +551,11 @@ class Result<Option<T>, E> final : public internal::ResultBase<Option<T>, E>
 public:
 #pragma region Constructors
     Result(ResultOkTag tag, T value)
+        : internal::ResultBase<Option<T>, E>(tag, Option<T>(std::move(value)))
+    {
+    }
+
+    Result(ResultOkTag tag, Option<T> value)
         : internal::ResultBase<Option<T>, E>(tag, value)
     {
     }
@@ -490,6 +564,13 @@ public:
         : internal::ResultBase<Option<T>, E>(tag, err)
     {
     }
+
+#ifdef __cpp_lib_expected
+    explicit Result(std::expected<Option<T>, E> value)
+        : internal::ResultBase<Option<T>, E>(std::move(value))
+    {
+    }
+#endif
 #pragma endregion
 
     Option<Result<T, E>> Transpose()
@@ -520,6 +601,13 @@ public:
         : internal::ResultBase<Result<T, E>, E>(tag, err)
     {
     }
+
+#ifdef __cpp_lib_expected
+    explicit Result(std::expected<Result<T, E>, E> value)
+        : internal::ResultBase<Result<T, E>, E>(std::move(value))
+    {
+    }
+#endif
 #pragma endregion
 
     Result<T, E> Flatten()
@@ -535,6 +623,26 @@ public:
     }
 };
 
+#ifdef __cpp_lib_expected
+/**
+ * Adopts a ``std::expected``, moving its value or error when given an rvalue.
+ */
+template<typename T, typename E>
+Result<T, E> FromStd(std::expected<T, E> const& value)
+{
+    return Result<T, E>(value);
+}
+
+template<typename T, typename E>
+Result<T, E> FromStd(std::expected<T, E>&& value)
+{
+    return Result<T, E>(std::move(value));
+}
+#endif
+
 } // namespace m24
 
+#define M24_RESULT_COMPLETE
+#include "ExternTemplates.h"
+
 #endif // RESULT2_H
@@ -0,0 +1,112 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef RESULT_FORMAT_H
+#define RESULT_FORMAT_H
+
+#include "Option.h"
+#include "Result.h"
+#include "Unchecked.h"
+
+#include <version>
+
+#ifdef __cpp_lib_format
+#include <concepts>
+#include <format>
+#include <string_view>
+#include <type_traits>
+
+namespace m24::internal
+{
+    /**
+     * ``std::formattable`` where the library has it; otherwise the same test it is specified by, a usable
+     * (non-disabled) ``std::formatter`` specialization.
+     */
+#ifdef __cpp_lib_format_ranges
+    template<typename T, typename CharT>
+    concept Formattable = std::formattable<T, CharT>;
+#else
+    template<typename T, typename CharT>
+    concept Formattable = std::semiregular<std::formatter<std::remove_cvref_t<T>, CharT>>;
+#endif
+
+    template<typename CharT, typename Out>
+    Out WriteLiteral(Out out, std::string_view text)
+    {
+        for (char const c : text) *out++ = static_cast<CharT>(c);
+        return out;
+    }
+} // namespace m24::internal
+
+/**
+ * Formats ``Some(value)`` or ``None``. The format spec applies to the value: ``{:>4}`` gives ``Some(   7)``.
+ */
+template<typename T, typename CharT>
+    requires(m24::internal::Formattable<T, CharT>)
+struct std::formatter<m24::Option<T>, CharT>
+{
+private:
+    std::formatter<T, CharT> _value;
+
+public:
+    constexpr auto parse(std::basic_format_parse_context<CharT>& context)
+    {
+        return _value.parse(context);
+    }
+
+    template<typename FormatContext>
+    auto format(m24::Option<T> const& option, FormatContext& context) const
+    {
+        if (option.IsNone()) return m24::internal::WriteLiteral<CharT>(context.out(), "None");
+
+        context.advance_to(m24::internal::WriteLiteral<CharT>(context.out(), "Some("));
+        context.advance_to(_value.format(m24::internal::Unchecked::Value(option), context));
+        return m24::internal::WriteLiteral<CharT>(context.out(), ")");
+    }
+};
+
+/**
+ * Formats ``Ok(value)`` or ``Err(error)``. The format spec applies to the Ok value; the error always uses its
+ * default format, so ``{:.2f}`` works for ``Result<double, std::string>``.
+ *
+ * Both ``T`` and ``E`` must be formattable. The default ``E = std::runtime_error`` is not, so ``Result<T>`` has no
+ * formatter: ``MapErr`` the error to a string first, or specialize ``std::formatter<std::runtime_error>``.
+ */
+template<typename T, typename E, typename CharT>
+    requires(m24::internal::Formattable<T, CharT> && m24::internal::Formattable<E, CharT>)
+struct std::formatter<m24::Result<T, E>, CharT>
+{
+private:
+    std::formatter<T, CharT> _value;
+    std::formatter<E, CharT> _error;
+
+public:
+    constexpr auto parse(std::basic_format_parse_context<CharT>& context)
+    {
+        std::basic_format_parse_context<CharT> defaults{std::basic_string_view<CharT>()};
+        _error.parse(defaults);
+
+        return _value.parse(context);
+    }
+
+    template<typename FormatContext>
+    auto format(m24::Result<T, E> const& result, FormatContext& context) const
+    {
+        if (result.IsOk())
+        {
+            context.advance_to(m24::internal::WriteLiteral<CharT>(context.out(), "Ok("));
+            context.advance_to(_value.format(m24::internal::Unchecked::Value(result), context));
+        }
+        else
+        {
+            context.advance_to(m24::internal::WriteLiteral<CharT>(context.out(), "Err("));
+            context.advance_to(_error.format(m24::internal::Unchecked::Err(result), context));
+        }
+
+        return m24::internal::WriteLiteral<CharT>(context.out(), ")");
+    }
+};
+#endif // __cpp_lib_format
+
+#endif // RESULT_FORMAT_H
@@ -0,0 +1,39 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef RESULT_IOSTREAM_H
+#define RESULT_IOSTREAM_H
+
+#include "Option.h"
+#include "Result.h"
+#include "Unchecked.h"
+
+#include <ostream>
+
+namespace m24
+{
+
+/**
+ * Opt-in ``std::ostream`` support, kept out of the core headers so they do not pull in iostreams.
+ * Prints ``Some(value)``/``None`` and ``Ok(value)``/``Err(error)``.
+ */
+template<typename T>
+std::ostream& operator<<(std::ostream& os, Option<T> const& option)
+{
+    if (option.IsNone()) return os << "None";
+
+    return os << "Some(" << internal::Unchecked::Value(option) << ")";
+}
+
+template<typename T, typename E>
+std::ostream& operator<<(std::ostream& os, Result<T, E> const& result)
+{
+    if (result.IsOk()) return os << "Ok(" << internal::Unchecked::Value(result) << ")";
+
+    return os << "Err(" << internal::Unchecked::Err(result) << ")";
+}
+
+} // namespace m24
+
+#endif // RESULT_IOSTREAM_H
@@ -67,7 +67,7 @@ template<typename T, typename E>
 Result<T, E> Err(E&& value)
     requires(std::is_rvalue_reference_v<E &&>)
 {
-    return Result<T, E>{ErrTag, std::forward<T>(value)};
+    return Result<T, E>{ErrTag, std::move(value)};
 }
 #pragma endregion
 
@@ -0,0 +1,283 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef RESULT_VECTOR_H
+#define RESULT_VECTOR_H
+
+#include "MaskedRange.h"
+#include "OptionRef.h"
+#include "Result.h"
+#include "Unchecked.h"
+#include "ValidityBitmap.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace m24
+{
+
+/**
+ * Columnar replacement for ``std::vector<Result<T, E>>`` tuned for rare errors:
+ * an ok-bitmap, a dense ``T`` column (Err slots hold a value-initialized ``T``) and a sparse,
+ * position-sorted side-table holding only the errors.
+ */
+template<typename T, typename E = std::runtime_error>
+class ResultVector
+{
+    static_assert(std::is_default_constructible_v<T>, "ResultVector<T, E> requires a default constructible T");
+    static_assert(!std::is_same_v<T, bool>, "ResultVector<bool, E> would sit on the bit-packed std::vector<bool>");
+
+public:
+    using ErrEntry = std::pair<std::size_t, E>;
+
+private:
+    std::vector<T> _values;
+    ValidityBitmap _ok;
+    std::vector<ErrEntry> _errors;
+
+public:
+    using value_type = Result<T, E>;
+    using size_type = std::size_t;
+
+#pragma region Constructors
+    ResultVector() = default;
+
+    explicit ResultVector(std::vector<Result<T, E>> const& results)
+    {
+        Append(results);
+    }
+
+    explicit ResultVector(std::vector<Result<T, E>>&& results)
+    {
+        Append(std::move(results));
+    }
+#pragma endregion
+
+#pragma region Capacity
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _values.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _values.empty();
+    }
+
+    void reserve(std::size_t size)
+    {
+        _values.reserve(size);
+        _ok.reserve(size);
+    }
+
+    void clear() noexcept
+    {
+        _values.clear();
+        _ok.clear();
+        _errors.clear();
+    }
+#pragma endregion
+
+#pragma region Modifiers
+    void push_back(Result<T, E> const& result)
+    {
+        if (result.IsOk())
+            PushOk(*result);
+        else
+            PushErr(result.UnwrapErr());
+    }
+
+    void push_back(Result<T, E>&& result)
+    {
+        if (result.IsOk())
+            PushOk(std::move(result).Unwrap());
+        else
+            PushErr(std::move(result).UnwrapErr());
+    }
+
+    void PushOk(T const& value)
+    {
+        _values.push_back(value);
+        _ok.push_back(true);
+    }
+
+    void PushOk(T&& value)
+    {
+        _values.push_back(std::move(value));
+        _ok.push_back(true);
+    }
+
+    void PushErr(E const& err)
+    {
+        _errors.emplace_back(size(), err);
+        _values.emplace_back();
+        _ok.push_back(false);
+    }
+
+    void PushErr(E&& err)
+    {
+        _errors.emplace_back(size(), std::move(err));
+        _values.emplace_back();
+        _ok.push_back(false);
+    }
+
+    /**
+     * Appends a whole batch of results, reserving up front for sized ranges and moving out of owning rvalue ranges;
+     * views such as ``std::span`` are copied from, since they do not own their elements.
+     */
+    template<std::ranges::input_range Range>
+        requires(std::is_convertible_v<std::ranges::range_reference_t<Range>, Result<T, E> const&>)
+    void Append(Range&& results)
+    {
+        if constexpr (std::ranges::sized_range<Range>) reserve(size() + std::ranges::size(results));
+
+        for (auto&& result : results)
+        {
+            if constexpr (internal::MovesElements<Range>)
+                push_back(std::move(result));
+            else
+                push_back(std::as_const(result));
+        }
+    }
+#pragma endregion
+
+#pragma region Access
+    [[nodiscard]] bool IsOk(std::size_t index) const noexcept
+    {
+        return _ok.Test(index);
+    }
+
+    [[nodiscard]] bool IsErr(std::size_t index) const noexcept
+    {
+        return !_ok.Test(index);
+    }
+
+    OptionRef<T> Ok(std::size_t index) noexcept
+    {
+        return OptionRef<T>::FromPointer(_ok.Test(index) ? &_values[index] : nullptr);
+    }
+
+    OptionRef<T const> Ok(std::size_t index) const noexcept
+    {
+        return OptionRef<T const>::FromPointer(_ok.Test(index) ? &_values[index] : nullptr);
+    }
+
+    /**
+     * Looks the error up in the side-table by binary search.
+     */
+    OptionRef<E const> Err(std::size_t index) const noexcept
+    {
+        if (_ok.Test(index)) return Prelude::None;
+
+        auto const it = std::ranges::lower_bound(_errors, index, {}, &ErrEntry::first);
+        return OptionRef<E const>(it->second);
+    }
+
+    Result<T, E> Get(std::size_t index) const
+    {
+        if (_ok.Test(index)) return Result<T, E>(OkTag, _values[index]);
+
+        return Result<T, E>(ErrTag, Err(index).Unwrap());
+    }
+
+    /**
+     * @return The dense value column, including the placeholder values of Err slots.
+     */
+    [[nodiscard]] std::span<T const> Values() const noexcept
+    {
+        return _values;
+    }
+
+    [[nodiscard]] ValidityBitmap const& OkMask() const noexcept
+    {
+        return _ok;
+    }
+#pragma endregion
+
+#pragma region Count
+    [[nodiscard]] std::size_t OkCount() const noexcept
+    {
+        return size() - _errors.size();
+    }
+
+    [[nodiscard]] std::size_t ErrCount() const noexcept
+    {
+        return _errors.size();
+    }
+
+    [[nodiscard]] bool AllOk() const noexcept
+    {
+        return _errors.empty();
+    }
+#pragma endregion
+
+#pragma region Iteration
+    /**
+     * @return Range over the Ok values only. With no errors this is a straight sweep of the value column.
+     */
+    internal::MaskedRange<T> Oks() noexcept
+    {
+        return internal::MaskedRange<T>(_ok, _values.data());
+    }
+
+    internal::MaskedRange<T const> Oks() const noexcept
+    {
+        return internal::MaskedRange<T const>(_ok, _values.data());
+    }
+
+    /**
+     * @return The error side-table as ``(position, error)`` pairs in position order.
+     */
+    [[nodiscard]] std::span<ErrEntry const> Errs() const noexcept
+    {
+        return _errors;
+    }
+#pragma endregion
+
+#pragma region Conversion
+    std::vector<Result<T, E>> ToResults() const&
+    {
+        std::vector<Result<T, E>> results;
+        results.reserve(size());
+
+        auto err = _errors.begin();
+        for (std::size_t i = 0; i < size(); ++i)
+        {
+            if (_ok.Test(i))
+                results.emplace_back(OkTag, _values[i]);
+            else
+                results.emplace_back(ErrTag, (err++)->second);
+        }
+
+        return results;
+    }
+
+    std::vector<Result<T, E>> ToResults() &&
+    {
+        std::vector<Result<T, E>> results;
+        results.reserve(size());
+
+        auto err = _errors.begin();
+        for (std::size_t i = 0; i < size(); ++i)
+        {
+            if (_ok.Test(i))
+                results.emplace_back(OkTag, std::move(_values[i]));
+            else
+                results.emplace_back(ErrTag, std::move((err++)->second));
+        }
+
+        clear();
+        return results;
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // RESULT_VECTOR_H
@@ -0,0 +1,267 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef SORT_KERNELS_H
+#define SORT_KERNELS_H
+
+#include "Option.h"
+#include "OptionVector.h"
+#include "Result.h"
+#include "ResultVector.h"
+#include "ValidityBitmap.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ranges>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace m24::Kernels
+{
+
+namespace internal
+{
+    template<typename T>
+    concept RadixSortable = (std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_floating_point_v<T>;
+
+    template<std::size_t Size>
+    struct UnsignedOfSize;
+
+    template<>
+    struct UnsignedOfSize<1>
+    {
+        using Type = std::uint8_t;
+    };
+
+    template<>
+    struct UnsignedOfSize<2>
+    {
+        using Type = std::uint16_t;
+    };
+
+    template<>
+    struct UnsignedOfSize<4>
+    {
+        using Type = std::uint32_t;
+    };
+
+    template<>
+    struct UnsignedOfSize<8>
+    {
+        using Type = std::uint64_t;
+    };
+
+    template<typename T>
+    using RadixKey = typename UnsignedOfSize<sizeof(T)>::Type;
+
+    /**
+     * Maps ``value`` to an unsigned key whose natural order matches ``T``'s order
+     * (sign bit flipped for signed integers, IEEE total-order trick for floating point).
+     */
+    template<RadixSortable T>
+    RadixKey<T> ToRadixKey(T value) noexcept
+    {
+        using Key = RadixKey<T>;
+        constexpr Key signBit = Key{1} << (sizeof(T) * 8 - 1);
+
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            Key const bits = std::bit_cast<Key>(value);
+            return bits & signBit ? static_cast<Key>(~bits) : static_cast<Key>(bits | signBit);
+        }
+        else if constexpr (std::is_signed_v<T>)
+        {
+            return static_cast<Key>(static_cast<Key>(value) ^ signBit);
+        }
+        else
+        {
+            return static_cast<Key>(value);
+        }
+    }
+
+    template<RadixSortable T>
+    T FromRadixKey(RadixKey<T> key) noexcept
+    {
+        using Key = RadixKey<T>;
+        constexpr Key signBit = Key{1} << (sizeof(T) * 8 - 1);
+
+        if constexpr (std::is_floating_point_v<T>)
+            return std::bit_cast<T>(key & signBit ? static_cast<Key>(key & ~signBit) : static_cast<Key>(~key));
+        else
+            return static_cast<T>(static_cast<Key>(key ^ (std::is_signed_v<T> ? signBit : Key{0})));
+    }
+
+    /**
+     * Stable LSD radix sort of ``keys`` one byte per pass, carrying ``payload`` along.
+     * Passes whose byte is identical for every key are skipped.
+     */
+    template<typename Key, typename Payload>
+    void RadixSort(std::vector<Key>& keys, std::vector<Payload>& payload)
+    {
+        std::vector<Key> keysBuffer(keys.size());
+        std::vector<Payload> payloadBuffer(payload.size());
+
+        for (std::size_t shift = 0; shift < sizeof(Key) * 8; shift += 8)
+        {
+            std::array<std::size_t, 256> offsets{};
+            for (Key const key : keys) ++offsets[(key >> shift) & 0xFF];
+
+            if (std::ranges::find(offsets, keys.size()) != offsets.end()) continue;
+
+            std::size_t total = 0;
+            for (std::size_t& offset : offsets) total += std::exchange(offset, total);
+
+            for (std::size_t i = 0; i < keys.size(); ++i)
+            {
+                std::size_t const target = offsets[(keys[i] >> shift) & 0xFF]++;
+                keysBuffer[target] = keys[i];
+                if (!payload.empty()) payloadBuffer[target] = std::move(payload[i]);
+            }
+
+            keys.swap(keysBuffer);
+            payload.swap(payloadBuffer);
+        }
+    }
+} // namespace internal
+
+#pragma region Sort
+/**
+ * Stable ordering permutation of ``column``: ``result[k]`` is the index of the ``k``-th element in sorted order.
+ * None is partitioned out via the validity bitmap first; only the Some keys go through the radix passes.
+ */
+template<internal::RadixSortable T>
+std::vector<std::size_t> ArgSort(OptionVector<T> const& column, NonePlacement placement = NonePlacement::Last)
+{
+    std::size_t const someCount = column.CountSome();
+
+    std::vector<internal::RadixKey<T>> keys;
+    std::vector<std::size_t> someIndices;
+    keys.reserve(someCount);
+    someIndices.reserve(someCount);
+    column.ForEachSome(
+        [&](std::size_t i, T const& value)
+        {
+            keys.push_back(internal::ToRadixKey(value));
+            someIndices.push_back(i);
+        });
+
+    internal::RadixSort(keys, someIndices);
+
+    std::vector<std::size_t> result;
+    result.reserve(column.size());
+
+    auto appendNones = [&]
+    {
+        for (std::size_t i = 0; i < column.size(); ++i)
+        {
+            if (column.IsNone(i)) result.push_back(i);
+        }
+    };
+
+    if (placement == NonePlacement::First) appendNones();
+    result.insert(result.end(), someIndices.begin(), someIndices.end());
+    if (placement == NonePlacement::Last) appendNones();
+
+    return result;
+}
+
+/**
+ * Sorts ``column`` in place, grouping all None at the front or back.
+ */
+template<internal::RadixSortable T>
+void Sort(OptionVector<T>& column, NonePlacement placement = NonePlacement::Last)
+{
+    std::size_t const size = column.size();
+    std::size_t const someCount = column.CountSome();
+
+    std::vector<internal::RadixKey<T>> keys;
+    keys.reserve(someCount);
+    for (T const& value : column.Somes()) keys.push_back(internal::ToRadixKey(value));
+
+    std::vector<std::byte> noPayload;
+    internal::RadixSort(keys, noPayload);
+
+    std::size_t const first = placement == NonePlacement::First ? size - someCount : 0;
+
+    std::vector<T> values(size);
+    ValidityBitmap validity(size);
+    for (std::size_t k = 0; k < someCount; ++k)
+    {
+        values[first + k] = internal::FromRadixKey<T>(keys[k]);
+        validity.Set(first + k);
+    }
+
+    column = OptionVector<T>(std::move(values), std::move(validity));
+}
+#pragma endregion
+
+#pragma region LowerBound
+/**
+ * Binary search on a column sorted by ``Sort`` with the same ``placement``.
+ * @return Index of the first Some value not less than ``value``; the end of the Some run if there is none.
+ */
+template<typename T>
+std::size_t LowerBound(OptionVector<T> const& sorted, T const& value, NonePlacement placement = NonePlacement::Last)
+{
+    std::size_t const first = placement == NonePlacement::First ? sorted.CountNone() : 0;
+    auto const somes = sorted.Values().subspan(first, sorted.CountSome());
+
+    return first + static_cast<std::size_t>(std::ranges::lower_bound(somes, value) - somes.begin());
+}
+
+/**
+ * @return Index of the first Some value greater than ``value``; the end of the Some run if there is none.
+ */
+template<typename T>
+std::size_t UpperBound(OptionVector<T> const& sorted, T const& value, NonePlacement placement = NonePlacement::Last)
+{
+    std::size_t const first = placement == NonePlacement::First ? sorted.CountNone() : 0;
+    auto const somes = sorted.Values().subspan(first, sorted.CountSome());
+
+    return first + static_cast<std::size_t>(std::ranges::upper_bound(somes, value) - somes.begin());
+}
+#pragma endregion
+
+#pragma region GroupErrsBy
+/**
+ * Buckets the positions of all Errs by ``key(err)``, e.g. an error code. Oks are never touched.
+ */
+template<typename T, typename E, typename KeyFunctor>
+auto GroupErrsBy(ResultVector<T, E> const& results, KeyFunctor&& key)
+{
+    using Key = std::decay_t<std::invoke_result_t<KeyFunctor&, E const&>>;
+
+    std::unordered_map<Key, std::vector<std::size_t>> groups;
+    for (auto const& [position, err] : results.Errs()) groups[key(err)].push_back(position);
+
+    return groups;
+}
+
+template<std::ranges::input_range Range, typename KeyFunctor>
+auto GroupErrsBy(Range&& results, KeyFunctor&& key)
+{
+    using E = std::decay_t<decltype(std::ranges::begin(results)->UnwrapErr())>;
+    using Key = std::decay_t<std::invoke_result_t<KeyFunctor&, E const&>>;
+
+    std::unordered_map<Key, std::vector<std::size_t>> groups;
+    std::size_t position = 0;
+    for (auto const& result : results)
+    {
+        if (result.IsErr()) groups[key(result.UnwrapErr())].push_back(position);
+        ++position;
+    }
+
+    return groups;
+}
+#pragma endregion
+
+} // namespace m24::Kernels
+
+#endif // SORT_KERNELS_H
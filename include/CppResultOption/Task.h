@@ -0,0 +1,352 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef TASK_H
+#define TASK_H
+
+#include "CancelledError.h"
+#include "Option.h"
+#include "Result.h"
+#include "ThreadPool.h"
+#include "Unchecked.h"
+
+#include <atomic>
+#include <concepts>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace m24
+{
+
+template<typename R>
+class Task;
+
+namespace internal
+{
+    /**
+     * Completion slot shared by a running task and the single consumer (``Get`` or a continuation) waiting on it.
+     */
+    template<typename T, typename E>
+    class TaskState
+    {
+    public:
+        using Continuation = std::move_only_function<void(Result<T, E>&&)>;
+
+    private:
+        std::atomic<bool> _ready{false};
+        Option<Result<T, E>> _result;
+        std::mutex _mutex;
+        Continuation _continuation;
+
+    public:
+        void Complete(Result<T, E>&& result)
+        {
+            Unchecked::Emplace(_result, std::move(result));
+
+            Continuation continuation;
+            {
+                std::lock_guard lock(_mutex);
+                _ready.store(true, std::memory_order_release);
+                continuation = std::move(_continuation);
+            }
+            _ready.notify_all();
+
+            if (continuation) continuation(std::move(Unchecked::Value(_result)));
+        }
+
+        /**
+         * Runs ``continuation`` with the result on the completing thread, or right away if already complete.
+         */
+        void OnComplete(Continuation continuation)
+        {
+            {
+                std::lock_guard lock(_mutex);
+                if (!_ready.load(std::memory_order_relaxed))
+                {
+                    _continuation = std::move(continuation);
+                    return;
+                }
+            }
+
+            continuation(std::move(Unchecked::Value(_result)));
+        }
+
+        [[nodiscard]] bool IsReady() const noexcept
+        {
+            return _ready.load(std::memory_order_acquire);
+        }
+
+        void Wait() const noexcept
+        {
+            while (!_ready.load(std::memory_order_acquire)) _ready.wait(false, std::memory_order_acquire);
+        }
+
+        Result<T, E>& Value() noexcept
+        {
+            return Unchecked::Value(_result);
+        }
+    };
+
+    template<typename>
+    struct TaskTraits : std::false_type
+    {
+    };
+
+    template<typename R>
+    struct TaskTraits<Task<R>> : std::true_type
+    {
+        using ResultType = R;
+    };
+
+    template<typename T>
+    concept TaskLike = TaskTraits<std::remove_cvref_t<T>>::value;
+} // namespace internal
+
+/**
+ * Handle to an asynchronously produced ``Result<T, E>``: failures travel as Err values, never as exceptions.
+ *
+ * A task that completes synchronously (constructed from a Result, or chained with ``Then`` onto a finished task)
+ * keeps its result inline and never allocates. Tasks are move-only and consumed by ``Get``, ``Then``, ``MapErr``
+ * and ``OnComplete``.
+ */
+template<typename T, typename E>
+class Task<Result<T, E>>
+{
+private:
+    using State = internal::TaskState<T, E>;
+
+    Option<Result<T, E>> _ready;
+    std::shared_ptr<State> _state;
+    ThreadPool* _pool = nullptr;
+
+    /**
+     * Produces ``Task<NewResult>`` from ``next(result)``: inline if this task is finished, otherwise on completion.
+     */
+    template<typename NewResult, typename Next>
+    Task<NewResult> Continue(Next&& next)
+    {
+        if (_ready.IsSome()) return Task<NewResult>(next(internal::Unchecked::Value(std::move(_ready))));
+        if (_state->IsReady()) return Task<NewResult>(next(std::move(_state->Value())));
+
+        using NewT = typename internal::ResultTraits<NewResult>::ValueType;
+        using NewE = typename internal::ResultTraits<NewResult>::ErrorType;
+
+        auto state = std::make_shared<internal::TaskState<NewT, NewE>>();
+        _state->OnComplete([state, next = std::forward<Next>(next)](Result<T, E>&& result) mutable
+                           { state->Complete(next(std::move(result))); });
+
+        return Task<NewResult>(std::move(state), _pool);
+    }
+
+public:
+    using ResultType = Result<T, E>;
+
+#pragma region Constructors
+    /**
+     * An already completed task; no allocation.
+     */
+    explicit Task(Result<T, E> const& result)
+        : _ready(result)
+    {
+    }
+
+    explicit Task(Result<T, E>&& result) noexcept(std::is_nothrow_move_constructible_v<Result<T, E>>)
+        : _ready(std::move(result))
+    {
+    }
+
+    /**
+     * A task completed through ``state``, as created by ``Spawn`` and the combinators.
+     */
+    Task(std::shared_ptr<State> state, ThreadPool* pool) noexcept
+        : _ready(),
+          _state(std::move(state)),
+          _pool(pool)
+    {
+    }
+
+    Task(Task&&) = default;
+    Task& operator=(Task&&) = default;
+#pragma endregion
+
+#pragma region Get
+    /**
+     * Waits for completion and returns the result. Called from a worker of the task's pool, the wait runs other
+     * queued jobs instead of blocking the worker.
+     */
+    Result<T, E> Get() &&
+    {
+        Wait();
+
+        if (_ready.IsSome()) return internal::Unchecked::Value(std::move(_ready));
+        return std::move(_state->Value());
+    }
+#pragma endregion
+
+#pragma region IsReady
+    [[nodiscard]] bool IsReady() const noexcept
+    {
+        return _ready.IsSome() || _state->IsReady();
+    }
+#pragma endregion
+
+#pragma region MapErr
+    /**
+     * ``Result::MapErr`` once the task completes: an Err becomes ``functor(err)``, an Ok passes through.
+     */
+    template<typename Functor>
+    auto MapErr(Functor&& functor) &&
+    {
+        using NewE = std::remove_cvref_t<std::invoke_result_t<Functor&, E&&>>;
+        using NewResult = Result<T, NewE>;
+
+        return Continue<NewResult>(
+            [functor = std::forward<Functor>(functor)](Result<T, E>&& result) mutable
+            {
+                if (result.IsOk()) return NewResult(OkTag, internal::Unchecked::Value(std::move(result)));
+                return NewResult(ErrTag, functor(internal::Unchecked::Err(std::move(result))));
+            });
+    }
+#pragma endregion
+
+#pragma region OnComplete
+    /**
+     * Calls ``callback(Result<T, E>&&)`` when the task completes, on the completing thread, or immediately if it
+     * already has.
+     */
+    template<typename Callback>
+    void OnComplete(Callback&& callback) &&
+    {
+        if (_ready.IsSome())
+        {
+            callback(internal::Unchecked::Value(std::move(_ready)));
+            return;
+        }
+
+        _state->OnComplete(std::forward<Callback>(callback));
+    }
+#pragma endregion
+
+#pragma region Pool
+    /**
+     * @return The pool the task runs on, ``nullptr`` for a task that completed synchronously.
+     */
+    [[nodiscard]] ThreadPool* Pool() const noexcept
+    {
+        return _pool;
+    }
+#pragma endregion
+
+#pragma region Then
+    /**
+     * Chains ``functor`` onto the Ok value once the task completes. A functor returning ``Result<U, E>`` behaves
+     * like ``AndThen``, any other return type like ``Map``; an Err skips ``functor`` and passes through.
+     */
+    template<typename Functor>
+    auto Then(Functor&& functor) &&
+    {
+        using Out = std::remove_cvref_t<std::invoke_result_t<Functor&, T&&>>;
+        using NewResult = std::conditional_t<internal::ResultLike<Out>, Out, Result<Out, E>>;
+
+        static_assert(std::is_same_v<typename internal::ResultTraits<NewResult>::ErrorType, E>,
+                      "Then must keep the error type; use MapErr to convert it first");
+
+        return Continue<NewResult>(
+            [functor = std::forward<Functor>(functor)](Result<T, E>&& result) mutable
+            {
+                if (result.IsErr()) return NewResult(ErrTag, internal::Unchecked::Err(std::move(result)));
+
+                if constexpr (internal::ResultLike<Out>)
+                    return NewResult(functor(internal::Unchecked::Value(std::move(result))));
+                else
+                    return NewResult(OkTag, functor(internal::Unchecked::Value(std::move(result))));
+            });
+    }
+#pragma endregion
+
+#pragma region Wait
+    void Wait() const
+    {
+        if (_ready.IsSome()) return;
+
+        if (_pool != nullptr && _pool->InWorker())
+        {
+            while (!_state->IsReady())
+                if (!_pool->RunOne()) std::this_thread::yield();
+
+            return;
+        }
+
+        _state->Wait();
+    }
+#pragma endregion
+};
+
+#pragma region Spawn
+/**
+ * Runs ``functor`` (returning a ``Result``) on ``pool``.
+ */
+template<typename Functor>
+    requires(internal::ResultLike<std::invoke_result_t<Functor&>>)
+auto Spawn(ThreadPool& pool, Functor&& functor)
+{
+    using R = std::remove_cvref_t<std::invoke_result_t<Functor&>>;
+    using State = internal::TaskState<typename internal::ResultTraits<R>::ValueType,
+                                      typename internal::ResultTraits<R>::ErrorType>;
+
+    auto state = std::make_shared<State>();
+    pool.Post([state, functor = std::forward<Functor>(functor)]() mutable { state->Complete(std::invoke(functor)); });
+
+    return Task<R>(std::move(state), &pool);
+}
+
+/**
+ * Runs ``functor`` on ``pool`` with cooperative cancellation. If ``token`` is already stopped when the task is
+ * picked up, ``functor`` is skipped and the task completes with ``Err(CancelledError())``; otherwise ``functor``
+ * receives the token (if it accepts one) to poll while it runs.
+ */
+template<typename Functor>
+    requires(std::invocable<Functor&, std::stop_token> || std::invocable<Functor&>)
+auto Spawn(ThreadPool& pool, std::stop_token token, Functor&& functor)
+{
+    using R = std::remove_cvref_t<typename std::conditional_t<std::invocable<Functor&, std::stop_token>,
+                                                              std::invoke_result<Functor&, std::stop_token>,
+                                                              std::invoke_result<Functor&>>::type>;
+    using T = typename internal::ResultTraits<R>::ValueType;
+    using E = typename internal::ResultTraits<R>::ErrorType;
+
+    static_assert(std::is_constructible_v<E, CancelledError>,
+                  "The error type must be constructible from CancelledError");
+
+    auto state = std::make_shared<internal::TaskState<T, E>>();
+    pool.Post(
+        [state, token = std::move(token), functor = std::forward<Functor>(functor)]() mutable
+        {
+            if (token.stop_requested())
+                state->Complete(Result<T, E>(ErrTag, E(CancelledError())));
+            else if constexpr (std::invocable<Functor&, std::stop_token>)
+                state->Complete(std::invoke(functor, token));
+            else
+                state->Complete(std::invoke(functor));
+        });
+
+    return Task<R>(std::move(state), &pool);
+}
+
+template<typename Functor>
+    requires(internal::ResultLike<std::invoke_result_t<Functor&>>)
+auto Spawn(Functor&& functor)
+{
+    return Spawn(ThreadPool::Default(), std::forward<Functor>(functor));
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // TASK_H
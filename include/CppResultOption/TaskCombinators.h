@@ -0,0 +1,303 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef TASK_COMBINATORS_H
+#define TASK_COMBINATORS_H
+
+#include "Option.h"
+#include "Result.h"
+#include "Task.h"
+#include "Unchecked.h"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <stop_token>
+#include <utility>
+#include <vector>
+
+namespace m24
+{
+
+namespace internal
+{
+    /**
+     * Shared bookkeeping for one combinator call: a slot per input, lock-free completion counters and the output
+     * task's state. Each input writes only its own slot and publishes it with a release store, so whoever decides
+     * the outcome can read every slot published before its own counter update without locks.
+     */
+    template<typename T, typename E, typename Out>
+    class WhenState
+    {
+    private:
+        using OutT = typename ResultTraits<Out>::ValueType;
+        using OutE = typename ResultTraits<Out>::ErrorType;
+
+        struct Slot
+        {
+            std::atomic<bool> published{false};
+            Option<Result<T, E>> result;
+        };
+
+        std::unique_ptr<Slot[]> _slots;
+        std::size_t _count;
+        std::atomic<bool> _decided{false};
+        std::stop_source _losers;
+
+    public:
+        std::atomic<std::size_t> remaining;
+        std::atomic<std::size_t> oks{0};
+        std::atomic<std::size_t> errs{0};
+        std::shared_ptr<TaskState<OutT, OutE>> const output = std::make_shared<TaskState<OutT, OutE>>();
+
+        WhenState(std::size_t count, std::stop_source losers)
+            : _slots(std::make_unique<Slot[]>(count)),
+              _count(count),
+              _losers(std::move(losers)),
+              remaining(count)
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return _count;
+        }
+
+        void Publish(std::size_t index, Result<T, E>&& result)
+        {
+            Unchecked::Emplace(_slots[index].result, std::move(result));
+            _slots[index].published.store(true, std::memory_order_release);
+        }
+
+        /**
+         * Claims the right to complete the output; the first caller wins and cancels the remaining inputs.
+         */
+        bool Decide() noexcept
+        {
+            if (_decided.exchange(true, std::memory_order_acq_rel)) return false;
+
+            if (_losers.stop_possible()) _losers.request_stop();
+            return true;
+        }
+
+        /**
+         * Moves out up to ``limit`` published Ok values (or Err values), in input order.
+         */
+        template<bool Ok>
+        auto Collect(std::size_t limit = std::numeric_limits<std::size_t>::max())
+        {
+            std::vector<std::conditional_t<Ok, T, E>> collected;
+            for (std::size_t i = 0; i < _count && collected.size() < limit; ++i)
+            {
+                if (!_slots[i].published.load(std::memory_order_acquire)) continue;
+
+                Result<T, E>& result = Unchecked::Value(_slots[i].result);
+                if constexpr (Ok)
+                {
+                    if (result.IsOk()) collected.push_back(Unchecked::Value(std::move(result)));
+                }
+                else
+                {
+                    if (result.IsErr()) collected.push_back(Unchecked::Err(std::move(result)));
+                }
+            }
+
+            return collected;
+        }
+
+        void Complete(Out&& result)
+        {
+            output->Complete(std::move(result));
+        }
+    };
+
+    /**
+     * Wires every input to ``onResult(state, index, result)`` and returns the output task. The output runs on the
+     * first pool among the inputs: a ready input has none, and waiting without one would block a worker.
+     */
+    template<typename Out, typename T, typename E, typename OnResult>
+    Task<Out> When(std::vector<Task<Result<T, E>>>&& tasks, std::stop_source losers, OnResult onResult)
+    {
+        ThreadPool* pool = nullptr;
+        for (std::size_t i = 0; i < tasks.size() && pool == nullptr; ++i) pool = tasks[i].Pool();
+
+        auto state = std::make_shared<WhenState<T, E, Out>>(tasks.size(), std::move(losers));
+
+        for (std::size_t i = 0; i < tasks.size(); ++i)
+            std::move(tasks[i]).OnComplete([state, i, onResult](Result<T, E>&& result) mutable
+                                           { onResult(*state, i, std::move(result)); });
+
+        return Task<Out>(state->output, pool);
+    }
+} // namespace internal
+
+#pragma region WhenAll
+/**
+ * Waits for every task. ``Ok`` with all values in input order, or ``Err`` with every error in input order.
+ */
+template<typename T, typename E>
+Task<Result<std::vector<T>, std::vector<E>>> WhenAll(std::vector<Task<Result<T, E>>> tasks)
+{
+    using Out = Result<std::vector<T>, std::vector<E>>;
+
+    if (tasks.empty()) return Task<Out>(Out(OkTag, std::vector<T>()));
+
+    return internal::When<Out>(std::move(tasks), std::stop_source(std::nostopstate),
+                               [](auto& state, std::size_t index, Result<T, E>&& result)
+                               {
+                                   state.Publish(index, std::move(result));
+                                   if (state.remaining.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+                                   std::vector<E> errors = state.template Collect<false>();
+                                   if (!errors.empty())
+                                       state.Complete(Out(ErrTag, std::move(errors)));
+                                   else
+                                       state.Complete(Out(OkTag, state.template Collect<true>()));
+                               });
+}
+#pragma endregion
+
+#pragma region WhenAny
+/**
+ * Completes with whichever task finishes first, Ok or Err, and requests a stop on ``losers``; the tasks should
+ * watch a token of ``losers``. Pass ``std::stop_source(std::nostopstate)`` to let the losers run to completion.
+ *
+ * @throws std::invalid_argument If ``tasks`` is empty.
+ */
+template<typename T, typename E>
+Task<Result<T, E>> WhenAny(std::vector<Task<Result<T, E>>> tasks, std::stop_source losers)
+{
+    if (tasks.empty()) throw std::invalid_argument("WhenAny requires at least one task");
+
+    return internal::When<Result<T, E>>(std::move(tasks), std::move(losers),
+                                        [](auto& state, std::size_t, Result<T, E>&& result)
+                                        {
+                                            if (state.Decide()) state.Complete(std::move(result));
+                                        });
+}
+
+/**
+ * ``WhenAny`` over the tasks returned by ``makeTasks(token)``, where ``token`` is stopped once the race is decided.
+ */
+template<typename MakeTasks>
+    requires(std::invocable<MakeTasks&, std::stop_token>)
+auto WhenAny(MakeTasks&& makeTasks)
+{
+    std::stop_source losers;
+    auto tasks = std::invoke(makeTasks, losers.get_token());
+
+    return WhenAny(std::move(tasks), std::move(losers));
+}
+#pragma endregion
+
+#pragma region FirstOk
+/**
+ * ``Or`` over concurrent producers, e.g. hedged requests: completes with the first Ok and requests a stop on
+ * ``losers``, whose token the tasks should watch. If every task fails, completes with all errors in input order.
+ */
+template<typename T, typename E>
+Task<Result<T, std::vector<E>>> FirstOk(std::vector<Task<Result<T, E>>> tasks, std::stop_source losers)
+{
+    using Out = Result<T, std::vector<E>>;
+
+    if (tasks.empty()) return Task<Out>(Out(ErrTag, std::vector<E>()));
+
+    return internal::When<Out>(std::move(tasks), std::move(losers),
+                               [](auto& state, std::size_t index, Result<T, E>&& result)
+                               {
+                                   if (result.IsOk())
+                                   {
+                                       if (state.Decide())
+                                           state.Complete(Out(OkTag, internal::Unchecked::Value(std::move(result))));
+                                       return;
+                                   }
+
+                                   state.Publish(index, std::move(result));
+                                   if (state.errs.fetch_add(1, std::memory_order_acq_rel) + 1 == state.size() &&
+                                       state.Decide())
+                                   {
+                                       state.Complete(Out(ErrTag, state.template Collect<false>()));
+                                   }
+                               });
+}
+
+/**
+ * ``FirstOk`` over the tasks returned by ``makeTasks(token)``, where ``token`` is stopped once an Ok arrives.
+ */
+template<typename MakeTasks>
+    requires(std::invocable<MakeTasks&, std::stop_token>)
+auto FirstOk(MakeTasks&& makeTasks)
+{
+    std::stop_source losers;
+    auto tasks = std::invoke(makeTasks, losers.get_token());
+
+    return FirstOk(std::move(tasks), std::move(losers));
+}
+#pragma endregion
+
+#pragma region Quorum
+/**
+ * Completes with the first ``k`` Ok values (in input order among those that arrived) as soon as ``k`` tasks have
+ * succeeded, or with the errors collected so far once ``k`` successes are no longer reachable. Either way a stop
+ * is requested on ``losers``.
+ *
+ * @throws std::invalid_argument If ``k`` exceeds the number of tasks.
+ */
+template<typename T, typename E>
+Task<Result<std::vector<T>, std::vector<E>>> Quorum(std::size_t k, std::vector<Task<Result<T, E>>> tasks,
+                                                    std::stop_source losers)
+{
+    using Out = Result<std::vector<T>, std::vector<E>>;
+
+    if (k > tasks.size()) throw std::invalid_argument("Quorum size exceeds the number of tasks");
+    if (k == 0)
+    {
+        if (losers.stop_possible()) losers.request_stop();
+        return Task<Out>(Out(OkTag, std::vector<T>()));
+    }
+
+    return internal::When<Out>(std::move(tasks), std::move(losers),
+                               [k](auto& state, std::size_t index, Result<T, E>&& result)
+                               {
+                                   bool const ok = result.IsOk();
+                                   state.Publish(index, std::move(result));
+
+                                   if (ok)
+                                   {
+                                       if (state.oks.fetch_add(1, std::memory_order_acq_rel) + 1 == k &&
+                                           state.Decide())
+                                       {
+                                           state.Complete(Out(OkTag, state.template Collect<true>(k)));
+                                       }
+                                   }
+                                   else if (state.errs.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+                                                state.size() - k + 1 &&
+                                            state.Decide())
+                                   {
+                                       state.Complete(Out(ErrTag, state.template Collect<false>()));
+                                   }
+                               });
+}
+
+/**
+ * ``Quorum`` over the tasks returned by ``makeTasks(token)``, where ``token`` is stopped once the outcome is known.
+ */
+template<typename MakeTasks>
+    requires(std::invocable<MakeTasks&, std::stop_token>)
+auto Quorum(std::size_t k, MakeTasks&& makeTasks)
+{
+    std::stop_source losers;
+    auto tasks = std::invoke(makeTasks, losers.get_token());
+
+    return Quorum(k, std::move(tasks), std::move(losers));
+}
+#pragma endregion
+
+} // namespace m24
+
+#endif // TASK_COMBINATORS_H
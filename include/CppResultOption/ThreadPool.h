@@ -0,0 +1,232 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include "AtomicOption.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace m24
+{
+
+/**
+ * Work-stealing thread pool. Every worker owns a deque: it pushes and pops its own jobs at the back (LIFO, cache
+ * warm) and steals from the front of a randomly chosen victim when it runs dry. Jobs posted from outside the pool
+ * are spread round-robin over the workers. Idle workers sleep and are only woken when somebody is actually asleep.
+ *
+ * Jobs must not throw; an escaping exception terminates the process, as with ``std::thread``.
+ */
+class ThreadPool
+{
+public:
+    using Job = std::move_only_function<void()>;
+
+private:
+    struct alignas(internal::CacheLineSize) WorkerQueue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    static inline thread_local ThreadPool* _currentPool = nullptr;
+    static inline thread_local std::size_t _currentWorker = 0;
+    static inline thread_local std::uint64_t _stealSeed = 0;
+
+    std::unique_ptr<WorkerQueue[]> _queues;
+    std::size_t _workerCount;
+
+    alignas(internal::CacheLineSize) std::atomic<std::size_t> _queued{0};
+    std::atomic<std::size_t> _sleeping{0};
+    std::atomic<std::size_t> _nextQueue{0};
+    std::atomic<bool> _stopping{false};
+
+    std::mutex _sleepMutex;
+    std::condition_variable _wakeup;
+
+    std::vector<std::jthread> _workers;
+
+    bool IsWorker() const noexcept
+    {
+        return _currentPool == this;
+    }
+
+    std::size_t NextVictim() noexcept
+    {
+        // xorshift64; seeded per thread so thieves do not all converge on the same victim.
+        if (_stealSeed == 0) _stealSeed = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1;
+
+        _stealSeed ^= _stealSeed << 13;
+        _stealSeed ^= _stealSeed >> 7;
+        _stealSeed ^= _stealSeed << 17;
+        return static_cast<std::size_t>(_stealSeed % _workerCount);
+    }
+
+    bool TryPop(Job& job)
+    {
+        if (IsWorker())
+        {
+            WorkerQueue& own = _queues[_currentWorker];
+            std::lock_guard lock(own.mutex);
+            if (!own.jobs.empty())
+            {
+                job = std::move(own.jobs.back());
+                own.jobs.pop_back();
+                return true;
+            }
+        }
+
+        std::size_t const start = NextVictim();
+        for (std::size_t k = 0; k < _workerCount; ++k)
+        {
+            std::size_t const victim = (start + k) % _workerCount;
+            if (IsWorker() && victim == _currentWorker) continue;
+
+            WorkerQueue& queue = _queues[victim];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.jobs.empty())
+            {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void WorkerLoop(std::size_t index)
+    {
+        _currentPool = this;
+        _currentWorker = index;
+
+        while (true)
+        {
+            if (RunOne()) continue;
+
+            std::unique_lock lock(_sleepMutex);
+            _sleeping.fetch_add(1);
+            _wakeup.wait(lock, [&] { return _queued.load() > 0 || _stopping.load(); });
+            _sleeping.fetch_sub(1);
+
+            if (_stopping.load() && _queued.load() == 0) return;
+        }
+    }
+
+public:
+#pragma region Constructors
+    /**
+     * @param threads Number of workers; 0 means ``std::thread::hardware_concurrency()``.
+     */
+    explicit ThreadPool(std::size_t threads = 0)
+        : _workerCount(std::max<std::size_t>(1, threads != 0 ? threads : std::thread::hardware_concurrency()))
+    {
+        _queues = std::make_unique<WorkerQueue[]>(_workerCount);
+
+        _workers.reserve(_workerCount);
+        for (std::size_t i = 0; i < _workerCount; ++i) _workers.emplace_back([this, i] { WorkerLoop(i); });
+    }
+
+    ThreadPool(ThreadPool const&) = delete;
+    ThreadPool& operator=(ThreadPool const&) = delete;
+
+    /**
+     * Runs every job already posted, then joins the workers.
+     */
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lock(_sleepMutex);
+            _stopping.store(true);
+        }
+        _wakeup.notify_all();
+        _workers.clear();
+    }
+
+    /**
+     * Process-wide pool sized to the hardware, created on first use.
+     */
+    static ThreadPool& Default()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+#pragma endregion
+
+#pragma region InWorker
+    /**
+     * @return Whether the calling thread is one of this pool's workers.
+     */
+    [[nodiscard]] bool InWorker() const noexcept
+    {
+        return IsWorker();
+    }
+#pragma endregion
+
+#pragma region Post
+    /**
+     * Queues ``job``. Called from a worker of this pool, the job goes to that worker's own deque.
+     */
+    void Post(Job job)
+    {
+        // Counted before it becomes visible so a thief can never drive the counter below zero.
+        _queued.fetch_add(1);
+
+        std::size_t const target = IsWorker() ? _currentWorker : _nextQueue.fetch_add(1) % _workerCount;
+        {
+            std::lock_guard lock(_queues[target].mutex);
+            _queues[target].jobs.push_back(std::move(job));
+        }
+
+        // Pairs with the sleeper incrementing _sleeping before re-checking _queued: one side always sees the other.
+        if (_sleeping.load() > 0)
+        {
+            {
+                std::lock_guard lock(_sleepMutex);
+            }
+            _wakeup.notify_one();
+        }
+    }
+#pragma endregion
+
+#pragma region RunOne
+    /**
+     * Runs one queued job on the calling thread, if any. Lets a thread that waits on pool work help instead of
+     * blocking a worker.
+     *
+     * @return Whether a job was run.
+     */
+    bool RunOne()
+    {
+        Job job;
+        if (!TryPop(job)) return false;
+
+        _queued.fetch_sub(1);
+        job();
+        return true;
+    }
+#pragma endregion
+
+#pragma region size
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _workerCount;
+    }
+#pragma endregion
+};
+
+} // namespace m24
+
+#endif // THREAD_POOL_H
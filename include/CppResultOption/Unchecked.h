@@ -0,0 +1,150 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef UNCHECKED_H
+#define UNCHECKED_H
+
+#include "Option.h"
+#include "Result.h"
+
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace m24
+{
+
+namespace internal
+{
+    template<typename>
+    struct OptionTraits : std::false_type
+    {
+    };
+
+    template<typename T>
+    struct OptionTraits<Option<T>> : std::true_type
+    {
+        using ValueType = T;
+    };
+
+    template<typename>
+    struct ResultTraits : std::false_type
+    {
+    };
+
+    template<typename T, typename E>
+    struct ResultTraits<Result<T, E>> : std::true_type
+    {
+        using ValueType = T;
+        using ErrorType = E;
+    };
+
+    template<typename T>
+    concept OptionLike = OptionTraits<std::remove_cvref_t<T>>::value;
+
+    template<typename T>
+    concept ResultLike = ResultTraits<std::remove_cvref_t<T>>::value;
+
+    /**
+     * Payload access without the IsSome/IsOk check of ``Unwrap``, for library algorithms that have
+     * already branched on the state and must not pay for (or be pessimized by) the throwing path.
+     * The caller guarantees the requested alternative is present.
+     */
+    struct Unchecked
+    {
+        template<typename T>
+        static T& Value(OptionBase<T>& option) noexcept
+        {
+            return *option._value;
+        }
+
+        template<typename T>
+        static T const& Value(OptionBase<T> const& option) noexcept
+        {
+            return *option._value;
+        }
+
+        template<typename T>
+        static T&& Value(OptionBase<T>&& option) noexcept
+        {
+            return std::move(*option._value);
+        }
+
+        /**
+         * Constructs the payload in place, destroying any previous one; the Option becomes Some.
+         */
+        template<typename T, typename... Args>
+        static T& Emplace(OptionBase<T>& option, Args&&... args)
+        {
+            return option._value.emplace(std::forward<Args>(args)...);
+        }
+
+        template<typename T, typename E>
+        static T& Value(ResultBase<T, E>& result) noexcept
+        {
+            return *result._okValue;
+        }
+
+        template<typename T, typename E>
+        static T const& Value(ResultBase<T, E> const& result) noexcept
+        {
+            return *result._okValue;
+        }
+
+        template<typename T, typename E>
+        static T&& Value(ResultBase<T, E>&& result) noexcept
+        {
+            return std::move(*result._okValue);
+        }
+
+        template<typename T, typename E>
+        static E& Err(ResultBase<T, E>& result) noexcept
+        {
+            return *result._errValue;
+        }
+
+        template<typename T, typename E>
+        static E const& Err(ResultBase<T, E> const& result) noexcept
+        {
+            return *result._errValue;
+        }
+
+        template<typename T, typename E>
+        static E&& Err(ResultBase<T, E>&& result) noexcept
+        {
+            return std::move(*result._errValue);
+        }
+    };
+
+    /**
+     * Elements are moved out of a range when they are prvalues or when the range itself is an owning rvalue
+     * (e.g. a ``std::vector&&``); lvalue ranges and non-owning views are only ever copied from.
+     */
+    template<typename Range>
+    inline constexpr bool MovesElements =
+        !std::is_lvalue_reference_v<std::ranges::range_reference_t<Range>> ||
+        (!std::is_lvalue_reference_v<Range> && !std::ranges::view<std::remove_cvref_t<Range>>);
+
+    template<typename Range, typename Element>
+    decltype(auto) ForwardValue(Element&& element) noexcept
+    {
+        if constexpr (MovesElements<Range>)
+            return Unchecked::Value(std::move(element));
+        else
+            return Unchecked::Value(std::as_const(element));
+    }
+
+    template<typename Range, typename Element>
+    decltype(auto) ForwardErr(Element&& element) noexcept
+    {
+        if constexpr (MovesElements<Range>)
+            return Unchecked::Err(std::move(element));
+        else
+            return Unchecked::Err(std::as_const(element));
+    }
+} // namespace internal
+
+} // namespace m24
+
+#endif // UNCHECKED_H
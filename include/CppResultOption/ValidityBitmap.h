@@ -0,0 +1,171 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef VALIDITY_BITMAP_H
+#define VALIDITY_BITMAP_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace m24
+{
+
+/**
+ * Packed bit-per-element presence mask (Arrow-style validity bitmap).
+ * Bit ``i`` lives in word ``i / 64`` at position ``i % 64``; bits past ``size()`` are always zero,
+ * so whole-word operations (popcount, skipping empty words) never need a tail mask.
+ */
+class ValidityBitmap
+{
+public:
+    using Word = std::uint64_t;
+
+    static constexpr std::size_t WordBits = 64;
+
+private:
+    std::vector<Word> _words;
+    std::size_t _size = 0;
+
+public:
+#pragma region Constructors
+    ValidityBitmap() = default;
+
+    explicit ValidityBitmap(std::size_t size, bool value = false)
+    {
+        resize(size, value);
+    }
+#pragma endregion
+
+#pragma region Capacity
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    void reserve(std::size_t size)
+    {
+        _words.reserve(WordCount(size));
+    }
+
+    void resize(std::size_t size, bool value = false)
+    {
+        std::size_t const oldSize = _size;
+        _words.resize(WordCount(size), 0);
+        _size = size;
+
+        if (size < oldSize)
+        {
+            ClearTail();
+            return;
+        }
+
+        if (!value) return;
+
+        for (std::size_t i = oldSize; i < size && i % WordBits != 0; ++i) Set(i);
+        std::size_t const firstFull = (oldSize + WordBits - 1) / WordBits;
+        for (std::size_t w = firstFull; w < _words.size(); ++w) _words[w] = ~Word{0};
+        ClearTail();
+    }
+
+    void clear() noexcept
+    {
+        _words.clear();
+        _size = 0;
+    }
+
+    [[nodiscard]] static constexpr std::size_t WordCount(std::size_t bits) noexcept
+    {
+        return (bits + WordBits - 1) / WordBits;
+    }
+#pragma endregion
+
+#pragma region Modifiers
+    void push_back(bool value)
+    {
+        if (_size % WordBits == 0) _words.push_back(0);
+        if (value) _words.back() |= Word{1} << (_size % WordBits);
+        ++_size;
+    }
+
+    void Set(std::size_t index, bool value = true) noexcept
+    {
+        Word const mask = Word{1} << (index % WordBits);
+        if (value)
+            _words[index / WordBits] |= mask;
+        else
+            _words[index / WordBits] &= ~mask;
+    }
+
+    void Reset(std::size_t index) noexcept
+    {
+        Set(index, false);
+    }
+#pragma endregion
+
+#pragma region Queries
+    [[nodiscard]] bool Test(std::size_t index) const noexcept
+    {
+        return (_words[index / WordBits] >> (index % WordBits)) & 1;
+    }
+
+    [[nodiscard]] std::size_t Count() const noexcept
+    {
+        std::size_t count = 0;
+        for (Word const word : _words) count += std::popcount(word);
+        return count;
+    }
+
+    /**
+     * @return Index of the first set bit at or after ``from``, or ``size()`` if there is none.
+     * Empty words are skipped 64 elements at a time.
+     */
+    [[nodiscard]] std::size_t FindNext(std::size_t from) const noexcept
+    {
+        if (from >= _size) return _size;
+
+        std::size_t w = from / WordBits;
+        Word word = _words[w] & (~Word{0} << (from % WordBits));
+
+        while (word == 0)
+        {
+            if (++w == _words.size()) return _size;
+            word = _words[w];
+        }
+
+        return w * WordBits + std::countr_zero(word);
+    }
+
+    [[nodiscard]] std::span<Word const> Words() const noexcept
+    {
+        return _words;
+    }
+
+    [[nodiscard]] std::span<Word> Words() noexcept
+    {
+        return _words;
+    }
+#pragma endregion
+
+#pragma region Operators
+    bool operator==(ValidityBitmap const& other) const noexcept = default;
+#pragma endregion
+
+private:
+    void ClearTail() noexcept
+    {
+        if (_size % WordBits != 0) _words.back() &= (Word{1} << (_size % WordBits)) - 1;
+    }
+};
+
+} // namespace m24
+
+#endif // VALIDITY_BITMAP_H
@@ -0,0 +1,469 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#ifndef VIEWS_H
+#define VIEWS_H
+
+#include "Option.h"
+#include "Result.h"
+#include "Unchecked.h"
+
+#include <concepts>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace m24::views
+{
+
+namespace internal
+{
+    using m24::internal::OptionLike;
+    using m24::internal::ResultLike;
+    using m24::internal::Unchecked;
+
+    /**
+     * Selects the Some/Ok payload. Lvalue elements are exposed by reference; prvalue elements
+     * (e.g. from a ``transform`` view) are moved out and exposed by value so nothing dangles.
+     */
+    struct ValueAccess
+    {
+        template<typename Element>
+        static bool Selected(Element const& element) noexcept
+        {
+            if constexpr (OptionLike<Element>)
+                return element.IsSome();
+            else
+                return element.IsOk();
+        }
+
+        template<typename Element>
+        static decltype(auto) Get(Element&& element) noexcept
+        {
+            if constexpr (std::is_lvalue_reference_v<Element>)
+                return Unchecked::Value(element);
+            else
+                return std::remove_cvref_t<decltype(Unchecked::Value(std::move(element)))>(
+                    Unchecked::Value(std::move(element)));
+        }
+    };
+
+    struct ErrAccess
+    {
+        template<typename Element>
+        static bool Selected(Element const& element) noexcept
+        {
+            return element.IsErr();
+        }
+
+        template<typename Element>
+        static decltype(auto) Get(Element&& element) noexcept
+        {
+            if constexpr (std::is_lvalue_reference_v<Element>)
+                return Unchecked::Err(element);
+            else
+                return std::remove_cvref_t<decltype(Unchecked::Err(std::move(element)))>(
+                    Unchecked::Err(std::move(element)));
+        }
+    };
+
+    template<typename V, typename Access>
+    using AccessReference = decltype(Access::Get(std::declval<std::ranges::range_reference_t<V>>()));
+
+#pragma region SelectView
+    /**
+     * Lazily yields the payload of every element that ``Access`` selects, skipping the rest, without going through
+     * the throwing ``Unwrap``. Lvalue elements are dereferenced once to test and again to read, as
+     * ``std::views::filter`` does. Prvalue elements (e.g. from a ``transform`` view) are computed once and cached in
+     * the iterator, which makes the view input-only, like ``std::views::cache_latest``.
+     */
+    template<std::ranges::view V, typename Access>
+    class SelectView : public std::ranges::view_interface<SelectView<V, Access>>
+    {
+    private:
+        V _base = V();
+
+        using Element = std::ranges::range_value_t<V>;
+
+        static constexpr bool Caches = !std::is_lvalue_reference_v<std::ranges::range_reference_t<V>>;
+        static constexpr bool Forward = std::ranges::forward_range<V> && !Caches;
+
+        struct NoCache
+        {
+        };
+
+        class Iterator
+        {
+        private:
+            std::ranges::iterator_t<V> _current = std::ranges::iterator_t<V>();
+            std::ranges::sentinel_t<V> _end = std::ranges::sentinel_t<V>();
+            [[no_unique_address]] mutable std::conditional_t<Caches, std::optional<Element>, NoCache> _cached;
+
+            void Satisfy()
+            {
+                if constexpr (Caches)
+                {
+                    for (; _current != _end; ++_current)
+                    {
+                        _cached.emplace(*_current);
+                        if (Access::Selected(*_cached)) return;
+                    }
+                    _cached.reset();
+                }
+                else
+                {
+                    while (_current != _end && !Access::Selected(*_current)) ++_current;
+                }
+            }
+
+        public:
+            using reference =
+                std::conditional_t<Caches,
+                                   std::remove_reference_t<decltype(Access::Get(std::declval<Element&>()))>&&,
+                                   AccessReference<V, Access>>;
+            using value_type = std::remove_cvref_t<reference>;
+            using difference_type = std::ranges::range_difference_t<V>;
+            using iterator_concept = std::conditional_t<Forward, std::forward_iterator_tag, std::input_iterator_tag>;
+
+            Iterator() = default;
+
+            Iterator(std::ranges::iterator_t<V> current, std::ranges::sentinel_t<V> end)
+                : _current(std::move(current)),
+                  _end(std::move(end))
+            {
+                Satisfy();
+            }
+
+            reference operator*() const
+            {
+                if constexpr (Caches)
+                    return std::move(Access::Get(*_cached));
+                else
+                    return Access::Get(*_current);
+            }
+
+            Iterator& operator++()
+            {
+                ++_current;
+                Satisfy();
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++*this;
+            }
+
+            Iterator operator++(int)
+                requires(Forward)
+            {
+                Iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            bool operator==(Iterator const& other) const
+                requires(std::equality_comparable<std::ranges::iterator_t<V>>)
+            {
+                return _current == other._current;
+            }
+
+            bool operator==(std::default_sentinel_t) const
+            {
+                return _current == _end;
+            }
+        };
+
+    public:
+        SelectView() = default;
+
+        explicit SelectView(V base)
+            : _base(std::move(base))
+        {
+        }
+
+        V base() const&
+            requires(std::copy_constructible<V>)
+        {
+            return _base;
+        }
+
+        Iterator begin()
+        {
+            return Iterator(std::ranges::begin(_base), std::ranges::end(_base));
+        }
+
+        auto end()
+        {
+            if constexpr (std::ranges::common_range<V>)
+                return Iterator(std::ranges::end(_base), std::ranges::end(_base));
+            else
+                return std::default_sentinel;
+        }
+    };
+#pragma endregion
+
+#pragma region TakeWhileView
+    /**
+     * Lazily yields the payload of the leading elements that ``Access`` selects and ends at the first one it does not.
+     * Works on unbounded input. Like ``std::views::take_while``, each element is dereferenced twice: once in the
+     * sentinel comparison and again in ``operator*``, so a ``transform`` in front of it runs twice per element.
+     */
+    template<std::ranges::view V, typename Access>
+    class TakeWhileView : public std::ranges::view_interface<TakeWhileView<V, Access>>
+    {
+    private:
+        V _base = V();
+
+        class Sentinel;
+
+        class Iterator
+        {
+        private:
+            std::ranges::iterator_t<V> _current = std::ranges::iterator_t<V>();
+
+            friend class Sentinel;
+
+        public:
+            using reference = AccessReference<V, Access>;
+            using value_type = std::remove_cvref_t<reference>;
+            using difference_type = std::ranges::range_difference_t<V>;
+            using iterator_concept =
+                std::conditional_t<std::ranges::forward_range<V>, std::forward_iterator_tag, std::input_iterator_tag>;
+
+            Iterator() = default;
+
+            explicit Iterator(std::ranges::iterator_t<V> current)
+                : _current(std::move(current))
+            {
+            }
+
+            reference operator*() const
+            {
+                return Access::Get(*_current);
+            }
+
+            Iterator& operator++()
+            {
+                ++_current;
+                return *this;
+            }
+
+            void operator++(int)
+            {
+                ++_current;
+            }
+
+            Iterator operator++(int)
+                requires(std::ranges::forward_range<V>)
+            {
+                Iterator result = *this;
+                ++_current;
+                return result;
+            }
+
+            bool operator==(Iterator const& other) const
+                requires(std::equality_comparable<std::ranges::iterator_t<V>>)
+            {
+                return _current == other._current;
+            }
+        };
+
+        class Sentinel
+        {
+        private:
+            std::ranges::sentinel_t<V> _end = std::ranges::sentinel_t<V>();
+
+        public:
+            Sentinel() = default;
+
+            explicit Sentinel(std::ranges::sentinel_t<V> end)
+                : _end(std::move(end))
+            {
+            }
+
+            bool operator==(Iterator const& it) const
+            {
+                return it._current == _end || !Access::Selected(*it._current);
+            }
+        };
+
+    public:
+        TakeWhileView() = default;
+
+        explicit TakeWhileView(V base)
+            : _base(std::move(base))
+        {
+        }
+
+        V base() const&
+            requires(std::copy_constructible<V>)
+        {
+            return _base;
+        }
+
+        Iterator begin()
+        {
+            return Iterator(std::ranges::begin(_base));
+        }
+
+        Sentinel end()
+        {
+            return Sentinel(std::ranges::end(_base));
+        }
+    };
+#pragma endregion
+
+#pragma region Closures
+    /**
+     * Minimal range adaptor closure: ``range | closure`` calls ``closure(range)``.
+     */
+    template<typename Function>
+    struct Closure
+    {
+        Function function;
+
+        template<std::ranges::viewable_range Range>
+        auto operator()(Range&& range) const
+        {
+            return function(std::forward<Range>(range));
+        }
+
+        template<std::ranges::viewable_range Range>
+        friend auto operator|(Range&& range, Closure const& closure)
+        {
+            return closure(std::forward<Range>(range));
+        }
+    };
+
+    template<typename Function>
+    Closure(Function) -> Closure<Function>;
+
+    template<typename Range>
+    using ElementOf = std::ranges::range_value_t<Range>;
+#pragma endregion
+} // namespace internal
+
+#pragma region Adaptors
+/**
+ * ``range<Option<T>> | somes`` yields the Some values.
+ */
+inline constexpr internal::Closure somes{
+    []<std::ranges::viewable_range Range>(Range&& range)
+        requires(internal::OptionLike<internal::ElementOf<Range>>)
+    {
+        return internal::SelectView<std::views::all_t<Range>, internal::ValueAccess>(
+            std::views::all(std::forward<Range>(range)));
+    }};
+
+/**
+ * ``range<Result<T, E>> | oks`` yields the Ok values.
+ */
+inline constexpr internal::Closure oks{
+    []<std::ranges::viewable_range Range>(Range&& range)
+        requires(internal::ResultLike<internal::ElementOf<Range>>)
+    {
+        return internal::SelectView<std::views::all_t<Range>, internal::ValueAccess>(
+            std::views::all(std::forward<Range>(range)));
+    }};
+
+/**
+ * ``range<Result<T, E>> | errs`` yields the Err values.
+ */
+inline constexpr internal::Closure errs{
+    []<std::ranges::viewable_range Range>(Range&& range)
+        requires(internal::ResultLike<internal::ElementOf<Range>>)
+    {
+        return internal::SelectView<std::views::all_t<Range>, internal::ErrAccess>(
+            std::views::all(std::forward<Range>(range)));
+    }};
+
+/**
+ * ``range<Result<T, E>> | take_while_ok`` (or a range of Options) yields the leading Ok/Some values
+ * and stops at the first Err/None without looking further.
+ */
+inline constexpr internal::Closure take_while_ok{
+    []<std::ranges::viewable_range Range>(Range&& range)
+        requires(internal::OptionLike<internal::ElementOf<Range>> || internal::ResultLike<internal::ElementOf<Range>>)
+    {
+        return internal::TakeWhileView<std::views::all_t<Range>, internal::ValueAccess>(
+            std::views::all(std::forward<Range>(range)));
+    }};
+
+/**
+ * Element-wise ``AndThen``: Some/Ok values are passed to ``functor``, which returns the new Option/Result;
+ * None/Err pass through. Keeps the size and traversal category of the input.
+ */
+template<typename Functor>
+auto and_then(Functor functor)
+{
+    return internal::Closure{
+        [functor = std::move(functor)]<std::ranges::viewable_range Range>(Range&& range)
+        {
+            return std::views::all(std::forward<Range>(range)) |
+                   std::views::transform(
+                       [functor]<typename Element>(Element&& element)
+                       {
+                           using Out = std::remove_cvref_t<decltype(functor(internal::ValueAccess::Get(element)))>;
+
+                           if constexpr (internal::OptionLike<Element>)
+                           {
+                               if (element.IsNone()) return Out();
+                           }
+                           else
+                           {
+                               if (element.IsErr()) return Out(ErrTag, internal::ErrAccess::Get(element));
+                           }
+
+                           return functor(internal::ValueAccess::Get(element));
+                       });
+        }};
+}
+
+/**
+ * Element-wise ``Map``: Ok/Some values become ``Ok(functor(value))``/``Some(functor(value))``;
+ * Err/None pass through. Keeps the size and traversal category of the input.
+ */
+template<typename Functor>
+auto map_ok(Functor functor)
+{
+    return internal::Closure{
+        [functor = std::move(functor)]<std::ranges::viewable_range Range>(Range&& range)
+        {
+            return std::views::all(std::forward<Range>(range)) |
+                   std::views::transform(
+                       [functor]<typename Element>(Element&& element)
+                       {
+                           using R = std::remove_cvref_t<decltype(functor(internal::ValueAccess::Get(element)))>;
+
+                           if constexpr (internal::OptionLike<Element>)
+                           {
+                               if (element.IsNone()) return Option<R>();
+                               return Option<R>(functor(internal::ValueAccess::Get(element)));
+                           }
+                           else
+                           {
+                               using E = typename m24::internal::ResultTraits<std::remove_cvref_t<Element>>::ErrorType;
+
+                               if (element.IsErr()) return Result<R, E>(ErrTag, internal::ErrAccess::Get(element));
+                               return Result<R, E>(OkTag, functor(internal::ValueAccess::Get(element)));
+                           }
+                       });
+        }};
+}
+#pragma endregion
+
+} // namespace m24::views
+
+template<typename V, typename Access>
+inline constexpr bool std::ranges::enable_borrowed_range<m24::views::internal::SelectView<V, Access>> =
+    std::ranges::enable_borrowed_range<V>;
+
+template<typename V, typename Access>
+inline constexpr bool std::ranges::enable_borrowed_range<m24::views::internal::TakeWhileView<V, Access>> =
+    std::ranges::enable_borrowed_range<V>;
+
+#endif // VIEWS_H
@@ -0,0 +1,63 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+module;
+
+#include "../include/CppResultOption/ErrExpectedException.h"
+#include "../include/CppResultOption/OkExpectedException.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/OptionMatcher.h"
+#include "../include/CppResultOption/OptionNone.h"
+#include "../include/CppResultOption/OptionPrelude.h"
+#include "../include/CppResultOption/OptionRef.h"
+#include "../include/CppResultOption/OverflowError.h"
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/ResultErr.h"
+#include "../include/CppResultOption/ResultOk.h"
+#include "../include/CppResultOption/ResultPrelude.h"
+#include "../include/CppResultOption/ResultTags.h"
+#include "../include/CppResultOption/SomeExpectedException.h"
+
+export module m24.result_option;
+
+/**
+ * Module interface over the core headers: ``import m24.result_option;`` instead of including Option.h/Result.h.
+ * The headers stay in the global module fragment, so a TU that imports the module and another that includes the
+ * headers see the same entities.
+ */
+export namespace m24
+{
+#pragma region Option
+using m24::Option;
+using m24::OptionMatcher;
+using m24::OptionRef;
+#pragma endregion
+
+#pragma region Result
+using m24::ErrTag;
+using m24::OkTag;
+using m24::Result;
+using m24::ResultErr;
+using m24::ResultErrTag;
+using m24::ResultOk;
+using m24::ResultOkTag;
+#pragma endregion
+
+#pragma region Exceptions
+using m24::ErrExpectedException;
+using m24::OkExpectedException;
+using m24::OverflowError;
+using m24::SomeExpectedException;
+#pragma endregion
+
+namespace Prelude
+{
+    using m24::Prelude::Err;
+    using m24::Prelude::None;
+    using m24::Prelude::NoneT;
+    using m24::Prelude::Ok;
+    using m24::Prelude::OptionNone;
+    using m24::Prelude::Some;
+} // namespace Prelude
+} // namespace m24
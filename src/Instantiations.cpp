@@ -0,0 +1,26 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include "../include/CppResultOption/Instantiations.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Result.h"
+
+namespace m24
+{
+
+#define M24_INSTANTIATE_OPTION(T)                                                                                      \
+    template class internal::OptionBase<T>;                                                                            \
+    template class Option<T>;
+
+#define M24_INSTANTIATE_RESULT(T, E)                                                                                   \
+    template class internal::ResultBase<T, E>;                                                                         \
+    template class Result<T, E>;
+
+M24_OPTION_INSTANTIATIONS(M24_INSTANTIATE_OPTION)
+M24_RESULT_INSTANTIATIONS(M24_INSTANTIATE_RESULT)
+
+#undef M24_INSTANTIATE_RESULT
+#undef M24_INSTANTIATE_OPTION
+
+} // namespace m24
@@ -0,0 +1,161 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/AtomicOption.h"
+#include "../include/CppResultOption/Option.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+struct Quote
+{
+    double bid = 0;
+    double ask = 0;
+    std::int64_t sequence = 0;
+};
+
+struct Pair16
+{
+    std::uint16_t first;
+    std::uint16_t second;
+};
+
+} // namespace
+
+#pragma region AtomicOption
+TEST(AtomicOption, TakeReplace)
+{
+    AtomicOption<int> slot;
+    static_assert(AtomicOption<int>::IsAlwaysLockFree);
+    static_assert(alignof(AtomicOption<int>) == 64);
+
+    EXPECT_TRUE(slot.IsNone());
+    EXPECT_EQ(slot.Replace(1), None);
+    EXPECT_EQ(slot.Replace(2), Some(1));
+    EXPECT_EQ(slot.Take(), Some(2));
+    EXPECT_EQ(slot.Take(), None);
+}
+
+TEST(AtomicOption, TryInsert)
+{
+    AtomicOption<Pair16> slot;
+
+    EXPECT_TRUE(slot.TryInsert({1, 2}));
+    EXPECT_FALSE(slot.TryInsert({3, 4}));
+    EXPECT_EQ(slot.Take().Unwrap().second, 2);
+}
+
+TEST(AtomicOption, CompareExchange)
+{
+    AtomicOption<int> slot(Some(5));
+    Option<int> expected = Some(4);
+
+    EXPECT_FALSE(slot.CompareExchange(expected, Some(6)));
+    EXPECT_EQ(expected, Some(5));
+    EXPECT_TRUE(slot.CompareExchange(expected, None));
+    EXPECT_EQ(slot.Load(), None);
+}
+
+TEST(AtomicOption, Pointer_SomeNullIsNotNone)
+{
+    int value = 7;
+    AtomicOption<int*> slot(Some<int*>(nullptr));
+
+    EXPECT_TRUE(slot.IsSome());
+    EXPECT_EQ(slot.Replace(&value), Some<int*>(nullptr));
+    EXPECT_EQ(*slot.Take().Unwrap(), 7);
+    EXPECT_TRUE(slot.IsNone());
+}
+
+TEST(AtomicOption, ConcurrentHandoff)
+{
+    constexpr int PerProducer = 10000;
+    AtomicOption<int> slot;
+    std::atomic<long> received{0};
+    std::atomic<int> receivedCount{0};
+
+    std::vector<std::jthread> threads;
+    for (int p = 0; p < 2; ++p)
+        threads.emplace_back(
+            [&]
+            {
+                for (int i = 1; i <= PerProducer; ++i)
+                    while (!slot.TryInsert(i)) std::this_thread::yield();
+            });
+    for (int c = 0; c < 2; ++c)
+        threads.emplace_back(
+            [&]
+            {
+                while (receivedCount.load() < 2 * PerProducer)
+                {
+                    Option<int> const value = slot.Take();
+                    if (value.IsNone())
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    received += value.Unwrap();
+                    ++receivedCount;
+                }
+            });
+    threads.clear();
+
+    EXPECT_EQ(received.load(), 2L * PerProducer * (PerProducer + 1) / 2);
+}
+#pragma endregion
+
+#pragma region SeqLockOption
+TEST(SeqLockOption, TakeReplace)
+{
+    SeqLockOption<Quote> slot;
+
+    EXPECT_TRUE(slot.TryInsert({1.0, 2.0, 1}));
+    EXPECT_FALSE(slot.TryInsert({3.0, 4.0, 2}));
+    EXPECT_EQ(slot.Replace({5.0, 6.0, 3}).Unwrap().sequence, 1);
+    EXPECT_EQ(slot.Load().Unwrap().ask, 6.0);
+    EXPECT_EQ(slot.Take().Unwrap().sequence, 3);
+    EXPECT_TRUE(slot.IsNone());
+}
+
+TEST(SeqLockOption, CompareExchange)
+{
+    SeqLockOption<Quote> slot;
+    Option<Quote> expected = None;
+
+    EXPECT_TRUE(slot.CompareExchange(expected, Some(Quote{1.0, 1.0, 1})));
+    EXPECT_FALSE(slot.CompareExchange(expected, None));
+    EXPECT_EQ(expected.Unwrap().sequence, 1);
+}
+
+TEST(SeqLockOption, LoadNeverTears)
+{
+    SeqLockOption<Quote> slot(Some(Quote{}));
+    std::atomic<bool> done{false};
+
+    std::jthread writer(
+        [&]
+        {
+            for (std::int64_t i = 1; i <= 50000; ++i) slot.Store(Some(Quote{double(i), double(i), i}));
+            done = true;
+        });
+
+    while (!done.load())
+    {
+        Quote const quote = slot.Load().Unwrap();
+        ASSERT_EQ(quote.bid, double(quote.sequence));
+        ASSERT_EQ(quote.ask, double(quote.sequence));
+    }
+}
+#pragma endregion
@@ -0,0 +1,155 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Channel.h"
+#include "../include/CppResultOption/Option.h"
+
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region Channel
+TEST(Channel, TrySendTryRecv)
+{
+    Channel<int> channel(3);
+
+    EXPECT_EQ(channel.capacity(), 4);
+    EXPECT_EQ(channel.TryRecv(), None);
+    for (int i = 0; i < 4; ++i) EXPECT_TRUE(channel.TrySend(i).IsOk());
+
+    auto const full = channel.TrySend(4);
+    ASSERT_TRUE(full.IsErr());
+    EXPECT_EQ(full.UnwrapErr().reason, ChannelError::Full);
+    EXPECT_EQ(full.UnwrapErr().value, 4);
+
+    EXPECT_EQ(channel.TryRecv(), Some(0));
+    EXPECT_TRUE(channel.TrySend(4).IsOk());
+}
+
+TEST(Channel, TrySend_HandsBackMoveOnly)
+{
+    Channel<std::unique_ptr<int>> channel(2);
+    channel.TrySend(std::make_unique<int>(1));
+    channel.TrySend(std::make_unique<int>(2));
+
+    auto rejected = channel.TrySend(std::make_unique<int>(3));
+
+    ASSERT_TRUE(rejected.IsErr());
+    EXPECT_EQ(*rejected.UnwrapErr().value, 3);
+}
+
+TEST(Channel, Recv_TimeoutAndClosed)
+{
+    Channel<int> channel(2);
+
+    EXPECT_EQ(channel.Recv(std::chrono::milliseconds(5)).UnwrapErr(), ChannelError::Timeout);
+
+    channel.TrySend(1);
+    channel.Close();
+
+    EXPECT_EQ(channel.TrySend(2).UnwrapErr().reason, ChannelError::Closed);
+    EXPECT_EQ(channel.Recv().Unwrap(), 1);
+    EXPECT_EQ(channel.Recv().UnwrapErr(), ChannelError::Closed);
+}
+
+TEST(Channel, Batch)
+{
+    Channel<int> channel(8);
+    std::vector<int> values{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    EXPECT_EQ(channel.TrySendBatch(values), 8);
+
+    std::vector<int> received;
+    EXPECT_EQ(channel.TryRecvBatch(std::back_inserter(received), 5), 5);
+    EXPECT_EQ(channel.TryRecvBatch(std::back_inserter(received), 5), 3);
+    EXPECT_EQ(received, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+}
+
+TEST(Channel, ManyProducersManyConsumers)
+{
+    constexpr int PerProducer = 20000;
+    Channel<int> channel(64);
+    std::atomic<long> sum{0};
+
+    {
+        std::vector<std::jthread> consumers;
+        for (int c = 0; c < 3; ++c)
+            consumers.emplace_back(
+                [&]
+                {
+                    while (true)
+                    {
+                        auto value = channel.Recv();
+                        if (value.IsErr()) return;
+                        sum += value.Unwrap();
+                    }
+                });
+
+        {
+            std::vector<std::jthread> producers;
+            for (int p = 0; p < 3; ++p)
+                producers.emplace_back(
+                    [&]
+                    {
+                        for (int i = 1; i <= PerProducer; ++i) ASSERT_TRUE(channel.Send(i).IsOk());
+                    });
+        }
+
+        channel.Close();
+    }
+
+    EXPECT_EQ(sum.load(), 3L * PerProducer * (PerProducer + 1) / 2);
+}
+#pragma endregion
+
+#pragma region SpscChannel
+TEST(SpscChannel, PreservesOrder)
+{
+    constexpr int Count = 100000;
+    SpscChannel<int> channel(128);
+    bool ordered = true;
+
+    std::jthread consumer(
+        [&]
+        {
+            int expected = 0;
+            std::vector<int> batch;
+            while (expected < Count)
+            {
+                batch.clear();
+                if (channel.TryRecvBatch(std::back_inserter(batch), 32) == 0)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                for (int value : batch) ordered &= value == expected++;
+            }
+        });
+
+    for (int i = 0; i < Count; ++i) channel.Send(i);
+    consumer.join();
+
+    EXPECT_TRUE(ordered);
+}
+
+TEST(SpscChannel, BatchRespectsCapacity)
+{
+    SpscChannel<int> channel(4);
+    std::vector<int> values{1, 2, 3, 4, 5, 6};
+
+    EXPECT_EQ(channel.TrySendBatch(values), 4);
+    EXPECT_TRUE(channel.TrySend(7).IsErr());
+    EXPECT_EQ(channel.TryRecv(), Some(1));
+    EXPECT_TRUE(channel.TrySend(7).IsOk());
+}
+#pragma endregion
@@ -0,0 +1,214 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Codec.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+struct Point
+{
+    std::int32_t x;
+    std::int32_t y;
+
+    bool operator==(Point const&) const = default;
+};
+
+struct Name
+{
+    std::string value;
+};
+
+} // namespace
+
+template<>
+struct m24::Codec<Name>
+{
+    static Result<std::monostate, EncodeError> Encode(Encoder& encoder, Name const& name)
+    {
+        return Codec<std::string>::Encode(encoder, name.value);
+    }
+
+    static Result<Name, DecodeError> Decode(Decoder& decoder)
+    {
+        return Codec<std::string>::Decode(decoder).Map<Name>([](std::string const& value) { return Name{value}; });
+    }
+};
+
+#pragma region Codec
+TEST(Codec, OptionRoundTrip)
+{
+    std::array<std::byte, 64> buffer{};
+    Encoder encoder(buffer);
+
+    ASSERT_TRUE(Encode(encoder, Some(Point{1, -2})).IsOk());
+    ASSERT_TRUE(Encode(encoder, Option<Point>()).IsOk());
+    EXPECT_EQ(encoder.size(), 1 + sizeof(Point) + 1);
+
+    Decoder decoder(encoder.Written());
+    EXPECT_EQ(Decode<Option<Point>>(decoder).Unwrap(), Some(Point{1, -2}));
+    EXPECT_EQ(Decode<Option<Point>>(decoder).Unwrap(), None);
+    EXPECT_EQ(Decode<Option<Point>>(decoder).UnwrapErr(), DecodeError::Truncated);
+}
+
+TEST(Codec, ResultRoundTrip)
+{
+    std::array<std::byte, 64> buffer{};
+    Encoder encoder(buffer);
+
+    Encode(encoder, Result<double, std::string>(OkTag, 2.5)).Unwrap();
+    Encode(encoder, Result<double, std::string>(ErrTag, "boom")).Unwrap();
+
+    Decoder decoder(encoder.Written());
+    EXPECT_EQ((Decode<Result<double, std::string>>(decoder).Unwrap().Unwrap()), 2.5);
+    EXPECT_EQ((Decode<Result<double, std::string>>(decoder).Unwrap().UnwrapErr()), "boom");
+    EXPECT_EQ(decoder.Remaining(), 0);
+}
+
+TEST(Codec, NestedAndCustom)
+{
+    std::array<std::byte, 64> buffer{};
+    Encoder encoder(buffer);
+    using Nested = Result<Option<Name>, std::int16_t>;
+
+    Encode(encoder, Nested(OkTag, Some(Name{"ada"}))).Unwrap();
+    Encode(encoder, Nested(ErrTag, std::int16_t{-7})).Unwrap();
+
+    Decoder decoder(encoder.Written());
+    EXPECT_EQ(Decode<Nested>(decoder).Unwrap().Unwrap().Unwrap().value, "ada");
+    EXPECT_EQ(Decode<Nested>(decoder).Unwrap().UnwrapErr(), -7);
+}
+
+TEST(Codec, BufferFullWritesNothing)
+{
+    std::array<std::byte, 6> buffer{};
+    Encoder encoder(buffer);
+
+    Encode(encoder, Some(std::uint8_t{1})).Unwrap();
+    EXPECT_EQ(Encode(encoder, Some(std::string("too long"))).UnwrapErr(), EncodeError::BufferFull);
+    EXPECT_EQ(encoder.size(), 2);
+
+    EXPECT_EQ(Encode(encoder, Some(std::uint16_t{5})).IsOk(), true);
+    EXPECT_EQ(encoder.size(), 5);
+}
+
+TEST(Codec, InvalidInput)
+{
+    std::array<std::byte, 2> tag{std::byte{7}, std::byte{0}};
+    Decoder badTag(tag);
+    EXPECT_EQ(Decode<Option<std::uint8_t>>(badTag).UnwrapErr(), DecodeError::InvalidTag);
+
+    std::array<std::byte, 11> varint{};
+    varint.fill(std::byte{0xFF});
+    Decoder badVarint(varint);
+    EXPECT_EQ(badVarint.ReadVarint().UnwrapErr(), DecodeError::InvalidVarint);
+
+    std::array<std::byte, 3> length{std::byte{0x10}, std::byte{'a'}, std::byte{'b'}};
+    Decoder shortString(length);
+    EXPECT_EQ(Decode<std::string>(shortString).UnwrapErr(), DecodeError::Truncated);
+}
+
+TEST(Codec, BoolIsRangeChecked)
+{
+    std::array<std::byte, 2> buffer{};
+    Encoder encoder(buffer);
+    ASSERT_TRUE(Encode(encoder, true).IsOk());
+    ASSERT_TRUE(Encode(encoder, false).IsOk());
+
+    Decoder decoder(encoder.Written());
+    EXPECT_TRUE(Decode<bool>(decoder).Unwrap());
+    EXPECT_FALSE(Decode<bool>(decoder).Unwrap());
+
+    std::array<std::byte, 1> invalid{std::byte{2}};
+    Decoder badBool(invalid);
+    EXPECT_EQ(Decode<bool>(badBool).UnwrapErr(), DecodeError::InvalidValue);
+}
+
+TEST(Codec, FixedWidthRequiresDenseRepresentation)
+{
+    struct Padded
+    {
+        std::uint8_t tag;
+        std::uint32_t value;
+    };
+
+    static_assert(FixedWidthCodable<Point>);
+    static_assert(FixedWidthCodable<double>);
+    static_assert(!FixedWidthCodable<bool>);
+    static_assert(!FixedWidthCodable<Padded>);
+    static_assert(!Codable<Padded>);
+}
+
+TEST(Codec, Varint)
+{
+    std::array<std::byte, 32> buffer{};
+    Encoder encoder(buffer);
+
+    encoder.WriteVarint(0).Unwrap();
+    encoder.WriteVarint(300).Unwrap();
+    encoder.WriteVarint(std::numeric_limits<std::uint64_t>::max()).Unwrap();
+    EXPECT_EQ(encoder.size(), 1 + 2 + 10);
+
+    Decoder decoder(encoder.Written());
+    EXPECT_EQ(decoder.ReadVarint().Unwrap(), 0);
+    EXPECT_EQ(decoder.ReadVarint().Unwrap(), 300);
+    EXPECT_EQ(decoder.ReadVarint().Unwrap(), std::numeric_limits<std::uint64_t>::max());
+}
+#pragma endregion
+
+#pragma region EncodeBatch
+TEST(EncodeBatch, RoundTrip)
+{
+    std::vector<Option<std::int64_t>> batch;
+    for (std::int64_t i = 0; i < 21; ++i) batch.push_back(i % 4 == 0 ? Option<std::int64_t>() : Some(i * 10));
+
+    std::array<std::byte, 256> buffer{};
+    Encoder encoder(buffer);
+    ASSERT_TRUE(EncodeBatch(encoder, batch).IsOk());
+
+    std::size_t const somes = 21 - 6;
+    EXPECT_EQ(encoder.size(), 1 + 3 + somes * sizeof(std::int64_t));
+
+    Decoder decoder(encoder.Written());
+    EXPECT_EQ(DecodeBatch<std::int64_t>(decoder).Unwrap(), batch);
+}
+
+TEST(EncodeBatch, BoundsChecked)
+{
+    std::vector<Option<std::int32_t>> const batch{Some(1), None, Some(3)};
+    std::array<std::byte, 64> buffer{};
+    Encoder encoder(buffer);
+    EncodeBatch(encoder, batch).Unwrap();
+
+    for (std::size_t cut = 0; cut < encoder.size(); ++cut)
+    {
+        Decoder truncated(encoder.Written().first(cut));
+        EXPECT_EQ(DecodeBatch<std::int32_t>(truncated).UnwrapErr(), DecodeError::Truncated);
+    }
+
+    std::array<std::byte, 4> small{};
+    Encoder tooSmall(small);
+    EXPECT_EQ(EncodeBatch(tooSmall, batch).UnwrapErr(), EncodeError::BufferFull);
+    EXPECT_EQ(tooSmall.size(), 0);
+
+    std::array<std::byte, 10> hugeCount{std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF}, std::byte{0xFF},
+                                        std::byte{0x0F}};
+    Decoder huge(hugeCount);
+    EXPECT_EQ(DecodeBatch<std::int32_t>(huge).UnwrapErr(), DecodeError::Truncated);
+}
+#pragma endregion
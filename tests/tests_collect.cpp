@@ -0,0 +1,125 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Collect.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <list>
+#include <memory>
+#include <ranges>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region Collect Option
+TEST(Collect, Option_AllSome)
+{
+    std::vector<Option<int>> const options{Some(1), Some(2), Some(3)};
+
+    Option<std::vector<int>> const actual = Collect(options);
+
+    EXPECT_EQ(actual, Some(std::vector<int>{1, 2, 3}));
+}
+
+TEST(Collect, Option_ShortCircuitsOnNone)
+{
+    int visited = 0;
+    auto counted = std::views::iota(0, 10) |
+                   std::views::transform(
+                       [&](int i)
+                       {
+                           ++visited;
+                           return i == 3 ? NoneT<int>() : Some(i);
+                       });
+
+    EXPECT_EQ(Collect(counted), None);
+    EXPECT_EQ(visited, 4);
+}
+
+TEST(Collect, Option_CustomContainer)
+{
+    std::vector<Option<int>> const options{Some(3), Some(1), Some(3)};
+
+    Option<std::set<int>> const actual = Collect<std::set<int>>(options);
+
+    EXPECT_EQ(actual, Some(std::set<int>{1, 3}));
+}
+#pragma endregion
+
+#pragma region Collect Result
+TEST(Collect, Result_AllOk)
+{
+    std::list<Result<int, std::string>> const results{Ok<int, std::string>(1), Ok<int, std::string>(2)};
+
+    Result<std::vector<int>, std::string> const actual = Collect(results);
+
+    ASSERT_TRUE(actual.IsOk());
+    EXPECT_EQ(actual.Unwrap(), (std::vector<int>{1, 2}));
+}
+
+TEST(Collect, Result_FirstErr)
+{
+    std::vector<Result<int, std::string>> const results{
+        Ok<int, std::string>(1), Err<int, std::string>("first"), Err<int, std::string>("second")};
+
+    Result<std::vector<int>, std::string> const actual = Collect(results);
+
+    EXPECT_EQ(actual.UnwrapErr(), "first");
+}
+
+TEST(Collect, Result_MovesFromRvalueRange)
+{
+    std::vector<Result<std::string, int>> results;
+    results.push_back(Ok<std::string, int>(std::string(100, 'x')));
+
+    Result<std::vector<std::string>, int> const actual = Collect(std::move(results));
+
+    EXPECT_EQ(actual.Unwrap().front().size(), 100);
+    EXPECT_TRUE(results.front().Unwrap().empty());
+}
+
+TEST(Collect, Result_CopiesFromLvalueRange)
+{
+    std::vector<Result<std::string, int>> results;
+    results.push_back(Ok<std::string, int>(std::string(100, 'x')));
+
+    Result<std::vector<std::string>, int> const actual = Collect(results);
+
+    EXPECT_EQ(actual.Unwrap().front().size(), 100);
+    EXPECT_EQ(results.front().Unwrap().size(), 100);
+}
+#pragma endregion
+
+#pragma region Partition
+TEST(Partition, SplitsOksAndErrs)
+{
+    std::vector<Result<int, std::string>> const results{
+        Ok<int, std::string>(1), Err<int, std::string>("a"), Ok<int, std::string>(3), Err<int, std::string>("b")};
+
+    auto const [oks, errs] = Partition(results);
+
+    EXPECT_EQ(oks, (std::vector<int>{1, 3}));
+    EXPECT_EQ(errs, (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(oks.capacity(), 2);
+    EXPECT_EQ(errs.capacity(), 2);
+}
+
+TEST(Partition, UnsizedInput)
+{
+    auto generated = std::views::iota(0, 6) | std::views::filter([](int i) { return i != 4; }) |
+                     std::views::transform(
+                         [](int i) { return i % 2 ? Err<int, int>(i) : Ok<int, int>(i); });
+
+    auto const [oks, errs] = Partition<std::list<int>>(generated);
+
+    EXPECT_EQ(oks, (std::list<int>{0, 2}));
+    EXPECT_EQ(errs, (std::vector<int>{1, 3, 5}));
+}
+#pragma endregion
@@ -0,0 +1,204 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/ColumnFile.h"
+#include "../include/CppResultOption/Option.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+class TempPath
+{
+private:
+    std::filesystem::path _path;
+
+public:
+    explicit TempPath(std::string const& name)
+        : _path(std::filesystem::temp_directory_path() / ("m24_column_" + name + "_" + std::to_string(::getpid())))
+    {
+    }
+
+    ~TempPath()
+    {
+        std::filesystem::remove(_path);
+    }
+
+    [[nodiscard]] std::string Path() const
+    {
+        return _path.string();
+    }
+};
+
+struct Timestamp
+{
+    std::int64_t seconds;
+    std::int32_t nanos;
+};
+
+template<typename T>
+ColumnFormatError FormatError(Result<MappedColumn<T>, ColumnError> const& opened)
+{
+    return std::get<ColumnFormatError>(opened.UnwrapErr());
+}
+
+} // namespace
+
+#pragma region ColumnFile
+TEST(ColumnFile, RoundTrip)
+{
+    TempPath temp("roundtrip");
+
+    auto writer = ColumnWriter<double>::Create(temp.Path(), 3).Unwrap();
+    writer.Append(1.5).Unwrap();
+    writer.AppendNone().Unwrap();
+    writer.Append(Some(2.5)).Unwrap();
+    writer.Append(Option<double>(None)).Unwrap();
+    writer.Append(4.0).Unwrap();
+    EXPECT_EQ(writer.Finish().Unwrap(), 5);
+
+    auto const column = MappedColumn<double>::Open(temp.Path()).Unwrap();
+
+    ASSERT_EQ(column.size(), 5);
+    EXPECT_EQ(column.Count(), 3);
+    EXPECT_EQ(column[0].Unwrap(), 1.5);
+    EXPECT_TRUE(column[1].IsNone());
+    EXPECT_EQ(column[2].Unwrap(), 2.5);
+    EXPECT_TRUE(column[3].IsNone());
+    EXPECT_EQ(column[4].Unwrap(), 4.0);
+    EXPECT_EQ(column.Values()[1], 0.0);
+}
+
+TEST(ColumnFile, ReferencesMapping)
+{
+    TempPath temp("zero_copy");
+
+    auto writer = ColumnWriter<std::int64_t>::Create(temp.Path()).Unwrap();
+    for (std::int64_t i = 0; i < 10; ++i) writer.Append(i).Unwrap();
+    writer.Finish().Unwrap();
+
+    auto const column = MappedColumn<std::int64_t>::Open(temp.Path(), ColumnAccess::Random).Unwrap();
+
+    EXPECT_EQ(&column[7].Unwrap(), column.Values().data() + 7);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(column.Values().data()) % 64, 0);
+}
+
+TEST(ColumnFile, LargeStreamedColumn)
+{
+    TempPath temp("large");
+    constexpr std::size_t Count = 100000;
+
+    auto writer = ColumnWriter<Timestamp>::Create(temp.Path(), 1000).Unwrap();
+    for (std::size_t i = 0; i < Count; ++i)
+    {
+        if (i % 3 == 0)
+            writer.AppendNone().Unwrap();
+        else
+            writer.Append(Timestamp{static_cast<std::int64_t>(i), static_cast<std::int32_t>(i % 1000)}).Unwrap();
+    }
+    writer.Finish().Unwrap();
+
+    auto const column = MappedColumn<Timestamp>::Open(temp.Path(), ColumnAccess::Sequential).Unwrap();
+    column.Prefetch(Count / 2, 1000);
+
+    ASSERT_EQ(column.size(), Count);
+
+    std::size_t somes = 0;
+    bool consistent = true;
+    column.ForEachSome(
+        [&](std::size_t index, Timestamp const& value)
+        {
+            ++somes;
+            consistent &= index % 3 != 0 && value.seconds == static_cast<std::int64_t>(index);
+        });
+
+    EXPECT_TRUE(consistent);
+    EXPECT_EQ(somes, Count - (Count + 2) / 3);
+    EXPECT_EQ(column.Count(), somes);
+
+    std::size_t index = 0;
+    for (OptionRef<Timestamp const> element : column) consistent &= element.IsSome() == (index++ % 3 != 0);
+    EXPECT_TRUE(consistent);
+}
+
+TEST(ColumnFile, Empty)
+{
+    TempPath temp("empty");
+
+    auto writer = ColumnWriter<int>::Create(temp.Path()).Unwrap();
+    EXPECT_EQ(writer.Finish().Unwrap(), 0);
+
+    auto const column = MappedColumn<int>::Open(temp.Path()).Unwrap();
+    EXPECT_TRUE(column.empty());
+    EXPECT_EQ(column.begin(), column.end());
+}
+
+TEST(ColumnFile, RejectsInvalidFiles)
+{
+    TempPath temp("invalid");
+
+    {
+        auto writer = ColumnWriter<int>::Create(temp.Path(), 2).Unwrap();
+        for (int i = 0; i < 5; ++i) writer.Append(i).Unwrap();
+    }
+    EXPECT_EQ(FormatError(MappedColumn<int>::Open(temp.Path())), ColumnFormatError::BadMagic);
+
+    {
+        auto writer = ColumnWriter<int>::Create(temp.Path()).Unwrap();
+        writer.Append(1).Unwrap();
+        writer.Finish().Unwrap();
+    }
+    EXPECT_EQ(FormatError(MappedColumn<double>::Open(temp.Path())), ColumnFormatError::TypeMismatch);
+
+    std::filesystem::resize_file(temp.Path(), 32);
+    EXPECT_EQ(FormatError(MappedColumn<int>::Open(temp.Path())), ColumnFormatError::Truncated);
+
+    auto const missing = MappedColumn<int>::Open(temp.Path() + ".missing");
+    EXPECT_EQ(std::get<io::IoError>(missing.UnwrapErr()), io::IoError{ENOENT});
+}
+
+TEST(ColumnFile, RejectsOverflowingHeader)
+{
+    TempPath temp("overflow");
+
+    auto const corrupt = [&](auto patch)
+    {
+        {
+            auto writer = ColumnWriter<int>::Create(temp.Path()).Unwrap();
+            writer.Append(1).Unwrap();
+            writer.Finish().Unwrap();
+        }
+
+        internal::ColumnHeader header{};
+        std::fstream file(temp.Path(), std::ios::in | std::ios::out | std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        patch(header);
+        file.seekp(0);
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.close();
+
+        return FormatError(MappedColumn<int>::Open(temp.Path()));
+    };
+
+    EXPECT_EQ(corrupt([](internal::ColumnHeader& header) { header.bitmapOffset = ~std::uint64_t{7}; }),
+              ColumnFormatError::Truncated);
+    EXPECT_EQ(corrupt([](internal::ColumnHeader& header) { header.size = std::uint64_t{1} << 62; }),
+              ColumnFormatError::Truncated);
+    EXPECT_EQ(corrupt([](internal::ColumnHeader& header) { header.valuesOffset = ~std::uint64_t{63}; }),
+              ColumnFormatError::Truncated);
+    EXPECT_EQ(corrupt([](internal::ColumnHeader& header) { header.size = ~std::uint64_t{0}; }),
+              ColumnFormatError::Truncated);
+}
+#pragma endregion
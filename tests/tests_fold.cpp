@@ -0,0 +1,133 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Fold.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/OptionVector.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region TryFold
+TEST(Fold, TryFold_Result)
+{
+    std::vector<Result<std::int64_t, std::string>> const shards{
+        Ok<std::int64_t, std::string>(10), Ok<std::int64_t, std::string>(20)};
+
+    auto const actual = TryFold(shards, std::string(), [](std::string acc, std::int64_t v) { return acc + std::to_string(v); });
+
+    EXPECT_EQ(actual.Unwrap(), "1020");
+}
+
+TEST(Fold, TryFold_StopsAtFirstErr)
+{
+    int visited = 0;
+    auto shards = std::views::iota(0) |
+                  std::views::transform(
+                      [&](int i)
+                      {
+                          ++visited;
+                          return i == 2 ? Err<int, std::string>("shard down") : Ok<int, std::string>(i);
+                      });
+
+    auto const actual = TryFold(shards, 0, [](int acc, int v) { return acc + v; });
+
+    EXPECT_EQ(actual.UnwrapErr(), "shard down");
+    EXPECT_EQ(visited, 3);
+}
+
+TEST(Fold, TryFold_FallibleFunctor)
+{
+    std::vector<Option<int>> const options{Some(1), Some(2), Some(3)};
+
+    auto const actual = TryFold(options, 0, [](int acc, int v) { return v == 3 ? NoneT<int>() : Some(acc + v); });
+
+    EXPECT_EQ(actual, None);
+}
+#pragma endregion
+
+#pragma region Sum / Product
+TEST(Fold, Sum)
+{
+    std::vector<Result<std::int64_t, std::string>> const ok{Ok<std::int64_t, std::string>(1),
+                                                            Ok<std::int64_t, std::string>(2)};
+    std::vector<Option<int>> const somes{Some(1), Some(2), Some(3)};
+    std::vector<Option<int>> const withNone{Some(1), None};
+
+    EXPECT_EQ(Sum(ok).Unwrap(), 3);
+    EXPECT_EQ(Sum(somes), Some(6));
+    EXPECT_EQ(Sum(withNone), None);
+    EXPECT_EQ(Product(somes), Some(6));
+}
+
+TEST(Fold, Sum_Column)
+{
+    OptionVector<double> column;
+    for (int i = 0; i < 100; ++i) column.push_back(i * 1.0);
+
+    EXPECT_EQ(Sum(column), Some(4950.0));
+    EXPECT_EQ(Max(column), Some(99.0));
+
+    column.PushNone();
+    EXPECT_EQ(Sum(column), None);
+    EXPECT_EQ(Min(column), None);
+}
+#pragma endregion
+
+#pragma region CheckedSum / CheckedProduct
+TEST(Fold, CheckedSum_Overflow)
+{
+    std::vector<Result<std::int32_t, std::runtime_error>> const results{
+        Ok<std::int32_t, std::runtime_error>(std::numeric_limits<std::int32_t>::max()),
+        Ok<std::int32_t, std::runtime_error>(1)};
+
+    EXPECT_TRUE(CheckedSum(results).IsErr());
+    EXPECT_EQ(CheckedProduct(results).Unwrap(), std::numeric_limits<std::int32_t>::max());
+
+    std::vector<Option<std::uint8_t>> const options{Some<std::uint8_t>(200), Some<std::uint8_t>(100)};
+    EXPECT_TRUE(CheckedSum(options).IsErr());
+
+    std::vector<Option<std::uint8_t>> const small{Some<std::uint8_t>(20), NoneT<std::uint8_t>()};
+    EXPECT_EQ(CheckedSum(small).Unwrap(), None);
+}
+#pragma endregion
+
+#pragma region Min / Max
+TEST(Fold, MinMax)
+{
+    std::vector<Result<int, std::string>> const results{Ok<int, std::string>(4), Ok<int, std::string>(-2)};
+    std::vector<Result<int, std::string>> const empty;
+
+    EXPECT_EQ(Min(results).Unwrap(), Some(-2));
+    EXPECT_EQ(Max(results).Unwrap(), Some(4));
+    EXPECT_EQ(Min(empty).Unwrap(), None);
+
+    std::vector<Option<int>> const options{Some(4), Some(-2)};
+    EXPECT_EQ(Min(options), Some(-2));
+    EXPECT_EQ(Max(options), Some(4));
+}
+#pragma endregion
+
+#pragma region AllOk / AnyErr
+TEST(Fold, AllOkAnyErr)
+{
+    std::vector<Result<int, std::string>> const results{Ok<int, std::string>(1), Err<int, std::string>("x")};
+    std::vector<Option<int>> const options{Some(1), Some(2)};
+
+    EXPECT_FALSE(AllOk(results));
+    EXPECT_TRUE(AnyErr(results));
+    EXPECT_TRUE(AllSome(options));
+    EXPECT_FALSE(AnyNone(options));
+}
+#pragma endregion
@@ -0,0 +1,61 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/ResultFormat.h"
+#include "../include/CppResultOption/ResultIostream.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region ResultIostream
+TEST(ResultIostream, Option)
+{
+    std::ostringstream stream;
+    stream << Some(3) << ' ' << Option<int>();
+
+    EXPECT_EQ(stream.str(), "Some(3) None");
+}
+
+TEST(ResultIostream, Result)
+{
+    std::ostringstream stream;
+    stream << Result<int, std::string>(OkTag, 1) << ' ' << Result<int, std::string>(ErrTag, "bad");
+
+    EXPECT_EQ(stream.str(), "Ok(1) Err(bad)");
+}
+#pragma endregion
+
+#ifdef __cpp_lib_format
+#pragma region ResultFormat
+TEST(ResultFormat, Option)
+{
+    EXPECT_EQ(std::format("{}", Some(3)), "Some(3)");
+    EXPECT_EQ(std::format("{}", Option<int>()), "None");
+    EXPECT_EQ(std::format("{:>4}", Some(7)), "Some(   7)");
+    EXPECT_EQ(std::format("{}", Some(Some(std::string("x")))), "Some(Some(x))");
+}
+
+TEST(ResultFormat, Result)
+{
+    EXPECT_EQ(std::format("{:.2f}", Result<double, std::string>(OkTag, 1.0 / 3)), "Ok(0.33)");
+    EXPECT_EQ(std::format("{:.2f}", Result<double, std::string>(ErrTag, "nan")), "Err(nan)");
+    EXPECT_EQ(std::format("{:#x}", Result<Option<int>, int>(OkTag, Some(255))), "Ok(Some(0xff))");
+}
+
+TEST(ResultFormat, RequiresFormattablePayloads)
+{
+    static_assert(internal::Formattable<Result<int, std::string>, char>);
+    static_assert(!internal::Formattable<Result<int>, char>);
+    static_assert(!internal::Formattable<Option<std::runtime_error>, char>);
+}
+#pragma endregion
+#endif
@@ -0,0 +1,137 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Generator.h"
+#include "../include/CppResultOption/Option.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+Generator<int> Iota(int count)
+{
+    for (int i = 0; i < count; ++i) co_yield i;
+}
+
+struct CopyCounter
+{
+    static inline int copies = 0;
+
+    CopyCounter() = default;
+
+    CopyCounter(CopyCounter const&)
+    {
+        ++copies;
+    }
+
+    CopyCounter(CopyCounter&&) noexcept = default;
+};
+
+Generator<CopyCounter> Counters(int count)
+{
+    for (int i = 0; i < count; ++i) co_yield CopyCounter();
+}
+
+TryGenerator<int, std::string> ParseDigits(std::string text)
+{
+    for (char c : text)
+    {
+        if (c < '0' || c > '9') co_yield Err<int, std::string>(std::string("bad digit: ") + c);
+        co_yield c - '0';
+    }
+}
+
+} // namespace
+
+#pragma region Generator
+TEST(Generator, Next)
+{
+    Generator<int> numbers = Iota(3);
+
+    EXPECT_EQ(numbers.Next(), Some(0));
+    EXPECT_EQ(numbers.Next(), Some(1));
+    EXPECT_EQ(numbers.Next(), Some(2));
+    EXPECT_EQ(numbers.Next(), None);
+    EXPECT_EQ(numbers.Next(), None);
+}
+
+TEST(Generator, RangeFor)
+{
+    std::vector<int> values;
+    for (int value : Iota(4)) values.push_back(value);
+
+    EXPECT_EQ(values, (std::vector<int>{0, 1, 2, 3}));
+}
+
+TEST(Generator, MovesOut)
+{
+    CopyCounter::copies = 0;
+    Generator<CopyCounter> counters = Counters(5);
+
+    while (counters.Next().IsSome())
+    {
+    }
+
+    EXPECT_EQ(CopyCounter::copies, 0);
+}
+
+TEST(Generator, MoveOnly)
+{
+    auto pointers = []() -> Generator<std::unique_ptr<int>> { co_yield std::make_unique<int>(9); }();
+
+    EXPECT_EQ(*pointers.Next().Unwrap(), 9);
+}
+
+TEST(Generator, RethrowsException)
+{
+    auto failing = []() -> Generator<int>
+    {
+        co_yield 1;
+        throw std::runtime_error("parse error");
+    }();
+
+    EXPECT_EQ(failing.Next(), Some(1));
+    EXPECT_THROW(failing.Next(), std::runtime_error);
+}
+
+TEST(Generator, FramesArePooled)
+{
+    Iota(1);
+    std::size_t const cached = internal::FramePool::Cached();
+    ASSERT_GT(cached, 0);
+
+    for (int i = 0; i < 1000; ++i) EXPECT_EQ(Iota(2).Next(), Some(0));
+
+    EXPECT_EQ(internal::FramePool::Cached(), cached);
+}
+#pragma endregion
+
+#pragma region TryGenerator
+TEST(TryGenerator, Ok)
+{
+    TryGenerator<int, std::string> digits = ParseDigits("12");
+
+    EXPECT_EQ(digits.Next().Unwrap(), Some(1));
+    EXPECT_EQ(digits.Next().Unwrap(), Some(2));
+    EXPECT_EQ(digits.Next().Unwrap(), None);
+}
+
+TEST(TryGenerator, TerminalErr)
+{
+    TryGenerator<int, std::string> digits = ParseDigits("1x2");
+
+    EXPECT_EQ(digits.Next().Unwrap(), Some(1));
+    EXPECT_EQ(digits.Next().UnwrapErr(), "bad digit: x");
+    EXPECT_EQ(digits.Next().Unwrap(), None);
+}
+#pragma endregion
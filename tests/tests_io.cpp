@@ -0,0 +1,220 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Io.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <array>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+using namespace m24::io;
+
+namespace
+{
+
+class TempFile
+{
+private:
+    std::filesystem::path _path;
+
+public:
+    explicit TempFile(std::string const& name)
+        : _path(std::filesystem::temp_directory_path() / ("m24_io_" + name + "_" + std::to_string(::getpid())))
+    {
+    }
+
+    ~TempFile()
+    {
+        std::filesystem::remove(_path);
+    }
+
+    [[nodiscard]] std::string Path() const
+    {
+        return _path.string();
+    }
+};
+
+std::span<std::byte const> Bytes(std::string const& text)
+{
+    return std::as_bytes(std::span(text));
+}
+
+std::string Text(std::span<std::byte const> bytes)
+{
+    return std::string(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+}
+
+class IoRing : public testing::TestWithParam<RingBackend>
+{
+protected:
+    Ring MakeRing(unsigned entries = 8)
+    {
+        auto ring = Ring::Create(entries, GetParam());
+        if (ring.IsErr()) throw std::runtime_error(ring.UnwrapErr().Message());
+        return std::move(ring).Unwrap();
+    }
+};
+
+} // namespace
+
+#pragma region File
+TEST(File, WriteAtReadAt)
+{
+    TempFile temp("file");
+    File file = File::Open(temp.Path(), O_RDWR | O_CREAT | O_TRUNC).Unwrap();
+
+    EXPECT_EQ(file.WriteAt(Bytes("hello world"), 0).Unwrap(), 11);
+
+    std::array<std::byte, 5> buffer{};
+    EXPECT_EQ(file.ReadAt(buffer, 6).Unwrap(), 5);
+    EXPECT_EQ(Text(buffer), "world");
+    EXPECT_EQ(file.ReadAt(buffer, 11).Unwrap(), 0);
+}
+
+TEST(File, OpenMissing)
+{
+    auto const file = File::Open("/nonexistent/m24/file");
+
+    ASSERT_TRUE(file.IsErr());
+    EXPECT_EQ(file.UnwrapErr(), IoError{ENOENT});
+    EXPECT_FALSE(file.UnwrapErr().Message().empty());
+}
+#pragma endregion
+
+#pragma region Ring
+TEST_P(IoRing, BatchedWritesThenReads)
+{
+    TempFile temp("batch");
+    File file = File::Open(temp.Path(), O_RDWR | O_CREAT | O_TRUNC).Unwrap();
+    Ring ring = MakeRing();
+
+    std::vector<std::string> const chunks{"alpha", "bravo", "charl", "delta"};
+    std::size_t written = 0;
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+        ASSERT_TRUE(ring.Write(file, Bytes(chunks[i]), i * 5, [&](Completion&& result) { written += result.Unwrap(); })
+                        .IsOk());
+
+    EXPECT_EQ(ring.InFlight(), 4);
+    EXPECT_EQ(ring.Submit().Unwrap(), 4);
+    ring.Drain().Unwrap();
+    EXPECT_EQ(written, 20);
+
+    std::vector<std::array<std::byte, 5>> buffers(chunks.size());
+    std::vector<std::string> read(chunks.size());
+    for (std::size_t i = 0; i < chunks.size(); ++i)
+        ring.Read(file, buffers[i], i * 5,
+                  [&, i](Completion&& result) { read[i] = Text(std::span(buffers[i]).first(result.Unwrap())); });
+
+    EXPECT_EQ(ring.Drain().Unwrap(), 4);
+    EXPECT_EQ(read, chunks);
+    EXPECT_EQ(ring.InFlight(), 0);
+}
+
+TEST_P(IoRing, ErrnoAsErr)
+{
+    TempFile temp("errno");
+    File file = File::Open(temp.Path(), O_WRONLY | O_CREAT | O_TRUNC).Unwrap();
+    Ring ring = MakeRing();
+
+    std::array<std::byte, 4> buffer{};
+    Option<IoError> error;
+    ring.Read(file, buffer, 0, [&](Completion&& result) { error = Some(result.UnwrapErr()); });
+    ring.Wait().Unwrap();
+
+    EXPECT_EQ(error, Some(IoError{EBADF}));
+}
+
+TEST_P(IoRing, AndThenChain)
+{
+    TempFile temp("chain");
+    File file = File::Open(temp.Path(), O_RDWR | O_CREAT | O_TRUNC).Unwrap();
+    file.WriteAt(Bytes("12345"), 0).Unwrap();
+    Ring ring = MakeRing();
+
+    std::array<std::byte, 8> buffer{};
+    Result<std::string, IoError> parsed = Err<std::string, IoError>(IoError{});
+    ring.Read(file, buffer, 0,
+              [&](Completion&& result)
+              {
+                  parsed = result.AndThen<std::string>(
+                      [&](std::size_t size) -> Result<std::string, IoError>
+                      {
+                          if (size != 5) return Err<std::string, IoError>(IoError{EIO});
+                          return Ok<std::string, IoError>(Text(std::span(buffer).first(size)));
+                      });
+              });
+    ring.Wait().Unwrap();
+
+    EXPECT_EQ(parsed.Unwrap(), "12345");
+}
+
+TEST_P(IoRing, HandlersQueueFollowUps)
+{
+    TempFile temp("followups");
+    File file = File::Open(temp.Path(), O_RDWR | O_CREAT | O_TRUNC).Unwrap();
+    Ring ring = MakeRing(2);
+
+    std::string const payload(64, 'x');
+    int remaining = 32;
+    std::size_t offset = 0;
+
+    std::function<void(Completion&&)> next = [&](Completion&& result)
+    {
+        offset += result.Unwrap();
+        if (--remaining > 0) ring.Write(file, Bytes(payload), offset, next);
+    };
+
+    ring.Write(file, Bytes(payload), 0, next);
+    ring.Drain().Unwrap();
+
+    EXPECT_EQ(offset, 32 * 64);
+    EXPECT_EQ(std::filesystem::file_size(temp.Path()), 32 * 64);
+}
+
+TEST_P(IoRing, MoreOpsThanEntries)
+{
+    TempFile temp("entries");
+    File file = File::Open(temp.Path(), O_RDWR | O_CREAT | O_TRUNC).Unwrap();
+    Ring ring = MakeRing(4);
+
+    std::string const byte = "z";
+    int completed = 0;
+    for (int i = 0; i < 100; ++i)
+        ASSERT_TRUE(ring.Write(file, Bytes(byte), i, [&](Completion&& result) { completed += result.IsOk(); }).IsOk());
+
+    ring.Drain().Unwrap();
+    EXPECT_EQ(completed, 100);
+}
+
+TEST_P(IoRing, RegisteredBuffers)
+{
+    TempFile temp("fixed");
+    File file = File::Open(temp.Path(), O_RDWR | O_CREAT | O_TRUNC).Unwrap();
+    file.WriteAt(Bytes("registered"), 0).Unwrap();
+    Ring ring = MakeRing();
+
+    std::array<std::byte, 16> first{};
+    std::array<std::byte, 16> second{};
+    std::array<std::span<std::byte>, 2> const buffers{first, second};
+    ASSERT_TRUE(ring.RegisterBuffers(buffers).IsOk());
+
+    std::size_t read = 0;
+    ring.ReadFixed(file, 1, 10, 0, [&](Completion&& result) { read = result.Unwrap(); });
+    ring.Drain().Unwrap();
+
+    EXPECT_EQ(Text(std::span(second).first(read)), "registered");
+    EXPECT_EQ(ring.ReadFixed(file, 2, 1, 0, {}).UnwrapErr(), IoError{EINVAL});
+    EXPECT_EQ(ring.ReadFixed(file, 0, 17, 0, {}).UnwrapErr(), IoError{EINVAL});
+}
+
+INSTANTIATE_TEST_SUITE_P(Backends, IoRing, testing::Values(RingBackend::Auto, RingBackend::ThreadPool));
+#pragma endregion
@@ -0,0 +1,121 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Lookup.h"
+
+#include <array>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region Find
+TEST(Lookup, FindRefersInPlace)
+{
+    std::unordered_map<int, std::string> map{{1, "one"}};
+
+    OptionRef<std::string> found = Find(map, 1);
+    ASSERT_TRUE(found.IsSome());
+    EXPECT_EQ(found.Get(), &map.at(1));
+
+    *found = "uno";
+    EXPECT_EQ(map.at(1), "uno");
+    EXPECT_TRUE(Find(map, 2).IsNone());
+}
+
+TEST(Lookup, FindHeterogeneousAndConst)
+{
+    std::map<std::string, int, std::less<>> const map{{"a", 1}};
+
+    OptionRef<int const> found = Find(map, std::string_view("a"));
+    EXPECT_EQ(*found, 1);
+    EXPECT_TRUE(Find(map, "b").IsNone());
+}
+
+TEST(Lookup, FindInSet)
+{
+    std::set<int> const set{3, 5};
+
+    EXPECT_EQ(*Find(set, 5), 5);
+    EXPECT_TRUE(Find(set, 4).IsNone());
+}
+#pragma endregion
+
+#pragma region Get
+TEST(Lookup, Get)
+{
+    std::vector<int> vector{10, 20};
+    std::array<int, 1> const array{7};
+
+    EXPECT_EQ(Get(vector, 1).Get(), &vector[1]);
+    EXPECT_TRUE(Get(vector, 2).IsNone());
+    EXPECT_EQ(*Get(array, 0), 7);
+}
+
+template<typename Container>
+concept Indexable = requires(Container& container) { Get(container, 0); };
+
+TEST(Lookup, GetRejectsMaps)
+{
+    static_assert(Indexable<std::deque<int>>);
+    static_assert(Indexable<std::string const>);
+    static_assert(!Indexable<std::map<std::size_t, int>>);
+    static_assert(!Indexable<std::unordered_map<std::size_t, int>>);
+
+    std::deque<int> deque{1, 2};
+    EXPECT_EQ(Get(deque, 1).Get(), &deque[1]);
+    EXPECT_TRUE(Get(deque, 2).IsNone());
+}
+
+TEST(Lookup, FrontBack)
+{
+    std::deque<int> deque{1, 2, 3};
+    std::vector<int> empty;
+
+    EXPECT_EQ(Front(deque).Get(), &deque.front());
+    EXPECT_EQ(*Back(deque), 3);
+    EXPECT_TRUE(Front(empty).IsNone());
+    EXPECT_TRUE(Back(empty).IsNone());
+}
+#pragma endregion
+
+#pragma region PopFront
+TEST(Lookup, PopFrontMoves)
+{
+    std::deque<std::unique_ptr<int>> deque;
+    deque.push_back(std::make_unique<int>(4));
+
+    Option<std::unique_ptr<int>> popped = PopFront(deque);
+    ASSERT_TRUE(popped.IsSome());
+    EXPECT_EQ(**popped, 4);
+    EXPECT_TRUE(deque.empty());
+    EXPECT_TRUE(PopFront(deque).IsNone());
+}
+#pragma endregion
+
+#pragma region TryEmplace
+TEST(Lookup, TryEmplace)
+{
+    std::unordered_map<int, std::string> map;
+
+    auto inserted = TryEmplace(map, 1, "one");
+    ASSERT_TRUE(inserted.IsOk());
+    EXPECT_EQ(&inserted.Unwrap().get(), &map.at(1));
+
+    auto existing = TryEmplace(map, 1, "uno");
+    ASSERT_TRUE(existing.IsErr());
+    EXPECT_EQ(existing.UnwrapErr().get(), "one");
+    EXPECT_EQ(&existing.UnwrapErr().get(), &map.at(1));
+}
+#pragma endregion
@@ -0,0 +1,34 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+import m24.result_option;
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region Module
+TEST(Module, ExportsOption)
+{
+    Option<int> const some = Some(2);
+    Option<int> const none = None;
+
+    EXPECT_EQ(some.Unwrap(), 2);
+    EXPECT_TRUE(none.IsNone());
+    EXPECT_EQ(none.UnwrapOr(7), 7);
+}
+
+TEST(Module, ExportsResult)
+{
+    Result<int, std::string> const ok = Ok<int, std::string>(3);
+    Result<int, std::string> const err = Err<int, std::string>("bad");
+
+    EXPECT_EQ(ok.Unwrap(), 3);
+    EXPECT_EQ(err.UnwrapErr(), "bad");
+    EXPECT_THROW((void)err.Unwrap(), OkExpectedException);
+}
+#pragma endregion
@@ -0,0 +1,189 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/NullableKernels.h"
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/OptionVector.h"
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+// Mostly-Some column with a fully None word, a fully Some word and a ragged tail.
+template<typename T>
+std::vector<Option<T>> MakeOptions()
+{
+    std::vector<Option<T>> options;
+    for (int i = 0; i < 333; ++i)
+    {
+        bool const some = (i >= 128 && i < 192) || (i >= 64 && i < 128 ? false : i % 3 != 0);
+        if (some)
+            options.push_back(Some(static_cast<T>((i * 37) % 101 - 50)));
+        else
+            options.push_back(NoneT<T>());
+    }
+    return options;
+}
+
+template<typename T>
+OptionVector<T> ToColumn(std::vector<Option<T>> const& options)
+{
+    OptionVector<T> column;
+    for (Option<T> const& option : options) column.push_back(option);
+    return column;
+}
+
+} // namespace
+
+#pragma region Kernels::Sum
+TEST(Kernels, Sum_MatchesOptionLoop)
+{
+    std::vector<Option<std::int64_t>> const options = MakeOptions<std::int64_t>();
+    std::int64_t expected = 0;
+    for (Option<std::int64_t> const& option : options) expected += option.UnwrapOr(0);
+
+    EXPECT_EQ(Kernels::Sum(ToColumn(options)), expected);
+}
+
+TEST(Kernels, Sum_Double_DispatchedMatchesScalar)
+{
+    OptionVector<double> const column = ToColumn(MakeOptions<double>());
+
+    double const scalar = Kernels::internal::SumScalar(column.Values(), column.Validity());
+    EXPECT_DOUBLE_EQ(Kernels::Sum(column), scalar);
+}
+#pragma endregion
+
+#pragma region Kernels::Min/Max/Mean
+TEST(Kernels, MinMax_MatchesOptionLoop)
+{
+    std::vector<Option<double>> const options = MakeOptions<double>();
+    double expectedMin = 1000;
+    double expectedMax = -1000;
+    for (Option<double> const& option : options)
+    {
+        if (option.IsNone()) continue;
+        expectedMin = std::min(expectedMin, *option);
+        expectedMax = std::max(expectedMax, *option);
+    }
+
+    OptionVector<double> const column = ToColumn(options);
+    EXPECT_EQ(Kernels::Min(column), Some(expectedMin));
+    EXPECT_EQ(Kernels::Max(column), Some(expectedMax));
+
+    OptionVector<int> const ints = ToColumn(MakeOptions<int>());
+    EXPECT_EQ(Kernels::Min(ints), Some(static_cast<int>(expectedMin)));
+    EXPECT_EQ(Kernels::Max(ints), Some(static_cast<int>(expectedMax)));
+}
+
+TEST(Kernels, Reductions_AllNone)
+{
+    OptionVector<double> const column(100);
+
+    EXPECT_EQ(Kernels::Sum(column), 0.0);
+    EXPECT_EQ(Kernels::Min(column), None);
+    EXPECT_EQ(Kernels::Max(column), None);
+    EXPECT_EQ(Kernels::Mean(column), None);
+}
+
+TEST(Kernels, Mean)
+{
+    OptionVector<int> const column{Some(1), None, Some(2), Some(6)};
+
+    EXPECT_EQ(Kernels::Mean(column), Some(3.0));
+}
+
+TEST(Kernels, Mean_DoesNotWrapIntegers)
+{
+    OptionVector<std::int8_t> const narrow{Some<std::int8_t>(100), Some<std::int8_t>(100), None};
+    OptionVector<std::int32_t> const large{Some(2'000'000'000), Some(2'000'000'000)};
+    OptionVector<std::uint16_t> const unsigned16{Some<std::uint16_t>(65535), Some<std::uint16_t>(65533)};
+
+    EXPECT_EQ(Kernels::Mean(narrow), Some(100.0));
+    EXPECT_EQ(Kernels::Mean(large), Some(2e9));
+    EXPECT_EQ(Kernels::Mean(unsigned16), Some(65534.0));
+}
+#pragma endregion
+
+#pragma region Kernels::IsSomeAnd/Filter
+TEST(Kernels, IsSomeAnd_MatchesOptionLoop)
+{
+    std::vector<Option<int>> const options = MakeOptions<int>();
+    auto positive = [](int x) { return x > 0; };
+
+    ValidityBitmap const actual = Kernels::IsSomeAnd(ToColumn(options), positive);
+
+    ASSERT_EQ(actual.size(), options.size());
+    for (std::size_t i = 0; i < options.size(); ++i) EXPECT_EQ(actual.Test(i), options[i].IsSomeAnd(positive)) << i;
+}
+
+TEST(Kernels, Filter_MatchesOptionLoop)
+{
+    std::vector<Option<int>> const options = MakeOptions<int>();
+    auto even = [](int const& x) { return x % 2 == 0; };
+
+    OptionVector<int> const actual = Kernels::Filter(ToColumn(options), even);
+
+    for (std::size_t i = 0; i < options.size(); ++i) EXPECT_EQ(actual[i], options[i].Filter(even)) << i;
+}
+
+TEST(Kernels, IsSomeAnd_SkipsNoneSlots)
+{
+    std::vector<Option<int>> const options = MakeOptions<int>();
+    OptionVector<int> const column = ToColumn(options);
+
+    std::size_t calls = 0;
+    Kernels::IsSomeAnd(column, [&](int) { return ++calls % 2 == 0; });
+
+    EXPECT_EQ(calls, column.Validity().Count());
+}
+#pragma endregion
+
+#pragma region Kernels::Map
+TEST(Kernels, Map_MatchesOptionLoop)
+{
+    std::vector<Option<int>> const options = MakeOptions<int>();
+    auto twice = [](int const& x) { return x * 2.0; };
+
+    OptionVector<double> const actual = Kernels::Map<double>(ToColumn(options), twice);
+
+    for (std::size_t i = 0; i < options.size(); ++i) EXPECT_EQ(actual[i], options[i].Map<double>(twice)) << i;
+}
+
+TEST(Kernels, Map_SkipsNoneSlots)
+{
+    OptionVector<int> const column{Some(4), None};
+
+    std::size_t calls = 0;
+    OptionVector<int> const actual = Kernels::Map<int>(column, [&](int x) {
+        ++calls;
+        if (x == 0) throw std::domain_error("division by zero");
+        return 100 / x;
+    });
+
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(actual[0], Some(25));
+    EXPECT_EQ(actual[1], None);
+}
+#pragma endregion
+
+#pragma region Kernels::UnwrapOr
+TEST(Kernels, UnwrapOr_MatchesOptionLoop)
+{
+    std::vector<Option<int>> const options = MakeOptions<int>();
+
+    std::vector<int> const actual = Kernels::UnwrapOr(ToColumn(options), -7);
+
+    ASSERT_EQ(actual.size(), options.size());
+    for (std::size_t i = 0; i < options.size(); ++i) EXPECT_EQ(actual[i], options[i].UnwrapOr(-7)) << i;
+}
+#pragma endregion
@@ -0,0 +1,126 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/OnceOption.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region OnceOption
+TEST(OnceOption, GetOrInit)
+{
+    OnceOption<std::string> config;
+    int calls = 0;
+
+    EXPECT_EQ(config.Get(), None);
+    EXPECT_EQ(config.GetOrInit([&] { return ++calls, std::string("parsed"); }), "parsed");
+    EXPECT_EQ(config.GetOrInit([&] { return ++calls, std::string("again"); }), "parsed");
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(*config.Get(), "parsed");
+}
+
+TEST(OnceOption, GetOrInit_ThrowRetries)
+{
+    OnceOption<int> cell;
+
+    EXPECT_THROW(cell.GetOrInit([]() -> int { throw std::runtime_error("boom"); }), std::runtime_error);
+    EXPECT_FALSE(cell.IsSome());
+    EXPECT_EQ(cell.GetOrInit([] { return 3; }), 3);
+}
+
+TEST(OnceOption, GetOrTryInit_ErrRetries)
+{
+    OnceOption<int> cell;
+
+    auto const failed = cell.GetOrTryInit([] { return Err<int, std::string>("unreachable"); });
+    EXPECT_EQ(failed.UnwrapErr(), "unreachable");
+    EXPECT_FALSE(cell.IsSome());
+
+    auto const succeeded = cell.GetOrTryInit([] { return Ok<int, std::string>(8); });
+    EXPECT_EQ(succeeded.Unwrap().get(), 8);
+    EXPECT_EQ(&succeeded.Unwrap().get(), &*cell.Get());
+}
+
+TEST(OnceOption, Set)
+{
+    OnceOption<int> cell;
+
+    EXPECT_TRUE(cell.Set(1));
+    EXPECT_FALSE(cell.Set(2));
+    EXPECT_EQ(cell.GetOrInit([] { return 3; }), 1);
+}
+
+TEST(OnceOption, StateWordIsTheOnlyFlag)
+{
+    static_assert(sizeof(OnceOption<std::uint64_t>) == 2 * sizeof(std::uint64_t));
+
+    auto const payload = std::make_shared<int>(5);
+    {
+        OnceOption<std::shared_ptr<int>> cell;
+        cell.Set(payload);
+        EXPECT_EQ(payload.use_count(), 2);
+    }
+    EXPECT_EQ(payload.use_count(), 1);
+
+    OnceOption<std::shared_ptr<int>> const empty;
+    EXPECT_EQ(empty.Get(), None);
+}
+
+TEST(OnceOption, ConcurrentInitRunsOnce)
+{
+    OnceOption<std::vector<int>> table;
+    std::atomic<int> calls{0};
+    std::atomic<long> seen{0};
+
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 8; ++t)
+            threads.emplace_back(
+                [&]
+                {
+                    std::vector<int> const& value = table.GetOrInit(
+                        [&]
+                        {
+                            ++calls;
+                            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                            return std::vector<int>(100, 1);
+                        });
+                    seen += static_cast<long>(value.size());
+                });
+    }
+
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(seen.load(), 800);
+}
+#pragma endregion
+
+#pragma region OnceResult
+TEST(OnceResult, CachesErr)
+{
+    OnceResult<int, std::string> cell;
+    int calls = 0;
+
+    auto init = [&]
+    {
+        ++calls;
+        return Err<int, std::string>("bad config");
+    };
+
+    EXPECT_EQ(cell.GetOrInit(init).UnwrapErr(), "bad config");
+    EXPECT_EQ(cell.GetOrInit(init).UnwrapErr(), "bad config");
+    EXPECT_EQ(calls, 1);
+    EXPECT_TRUE(cell.Get()->IsErr());
+}
+#pragma endregion
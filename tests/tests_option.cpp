@@ -7,6 +7,14 @@
 #include "../include/CppResultOption/Option.h"
 #include "../include/CppResultOption/Result.h"
 
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <vector>
+
 using namespace m24;
 using namespace m24::Prelude;
 
@@ -169,6 +177,49 @@ TEST(Option, Option_IsSome_None)
 }
 #pragma endregion
 
+#pragma region Option::Iter
+TEST(Option, Iter_Some)
+{
+    Option<int> option = Some(42);
+
+    for (int& value : option) value += 1;
+
+    static_assert(std::ranges::contiguous_range<Option<int>>);
+    static_assert(std::ranges::sized_range<Option<int>>);
+    EXPECT_EQ(option.size(), 1);
+    EXPECT_EQ(option, Some(43));
+    EXPECT_EQ(std::ranges::count(option, 43), 1);
+}
+
+TEST(Option, Iter_None)
+{
+    Option<int> const option = None;
+
+    EXPECT_EQ(option.begin(), option.end());
+    EXPECT_TRUE(option.Iter().empty());
+}
+
+TEST(Option, Iter_Join)
+{
+    std::vector<Option<int>> const options{Some(1), None, Some(3)};
+
+    std::vector<int> actual;
+    for (int value : options | std::views::join) actual.push_back(value);
+
+    EXPECT_EQ(actual, (std::vector<int>{1, 3}));
+}
+
+TEST(Option, Iter_ResultOk)
+{
+    Result<int, int> const ok = Ok<int, int>(7);
+    Result<int, int> const err = Err<int, int>(7);
+
+    EXPECT_EQ(ok.Iter().size(), 1);
+    EXPECT_EQ(ok.Iter().front(), 7);
+    EXPECT_TRUE(err.Iter().empty());
+}
+#pragma endregion
+
 #pragma region Option::Map
 TEST(Option, Map_Some)
 {
@@ -334,6 +385,33 @@ TEST(Option, Replace_None)
 }
 #pragma endregion
 
+#pragma region Option::Std
+TEST(Option, Std_RoundTrip)
+{
+    EXPECT_EQ(FromStd(std::optional<int>(4)), Some(4));
+    EXPECT_EQ(FromStd(std::optional<int>()), None);
+    EXPECT_EQ(Some(5).ToStd(), std::optional<int>(5));
+    EXPECT_EQ(Option<int>().ToStd(), std::nullopt);
+}
+
+TEST(Option, Std_AsStdAliases)
+{
+    Option<int> a = Some(1);
+    a.AsStd() = 2;
+
+    EXPECT_EQ(a, Some(2));
+    EXPECT_EQ(&a.AsStd().value(), &a.Unwrap());
+}
+
+TEST(Option, Std_Moves)
+{
+    Option<std::unique_ptr<int>> a = FromStd(std::optional(std::make_unique<int>(3)));
+    std::optional<std::unique_ptr<int>> b = std::move(a).ToStd();
+
+    EXPECT_EQ(**b, 3);
+}
+#pragma endregion
+
 #pragma region Option::Take
 TEST(Option, Take_Some)
 {
@@ -470,3 +548,49 @@ TEST(Option, Zip_NoneNone)
 }
 
 #pragma endregion
+
+#pragma region Option::operator<=>
+TEST(Option, Compare_NoneBeforeSome)
+{
+    Option<int> const none = None;
+    Option<int> const small = Some(1);
+    Option<int> const large = Some(2);
+
+    EXPECT_LT(none, small);
+    EXPECT_LT(small, large);
+    EXPECT_GT(large, none);
+    EXPECT_LE(none, none);
+}
+
+TEST(Option, Compare_PartialOrderingAndUnorderedPayloads)
+{
+    struct Unordered
+    {
+    };
+
+    static_assert(std::same_as<decltype(Some(1.0) <=> Some(2.0)), std::partial_ordering>);
+
+    Option<Unordered> const value = Some(Unordered{});
+    EXPECT_TRUE(value.IsSome());
+}
+
+TEST(Option, OptionLess_NoneLast)
+{
+    std::vector<Option<int>> options{Some(3), None, Some(1), None, Some(2)};
+
+    std::sort(options.begin(), options.end(), OptionLess<NonePlacement::Last>());
+
+    std::vector<Option<int>> const expected{Some(1), Some(2), Some(3), None, None};
+    EXPECT_EQ(options, expected);
+}
+
+TEST(Option, OptionLess_NoneFirst)
+{
+    std::vector<Option<int>> options{Some(3), None, Some(1)};
+
+    std::sort(options.begin(), options.end(), OptionLess<NonePlacement::First>());
+
+    std::vector<Option<int>> const expected{None, Some(1), Some(3)};
+    EXPECT_EQ(options, expected);
+}
+#pragma endregion
@@ -0,0 +1,158 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/OptionVector.h"
+
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region ValidityBitmap
+TEST(ValidityBitmap, PushBackAndTest)
+{
+    ValidityBitmap bitmap;
+    for (std::size_t i = 0; i < 130; ++i) bitmap.push_back(i % 3 == 0);
+
+    EXPECT_EQ(bitmap.size(), 130);
+    EXPECT_EQ(bitmap.Words().size(), 3);
+    EXPECT_TRUE(bitmap.Test(0));
+    EXPECT_FALSE(bitmap.Test(1));
+    EXPECT_TRUE(bitmap.Test(129));
+    EXPECT_EQ(bitmap.Count(), 44);
+}
+
+TEST(ValidityBitmap, Resize_KeepsTailClear)
+{
+    ValidityBitmap bitmap(70, true);
+    EXPECT_EQ(bitmap.Count(), 70);
+
+    bitmap.resize(65);
+    EXPECT_EQ(bitmap.Count(), 65);
+
+    bitmap.resize(200, false);
+    EXPECT_EQ(bitmap.Count(), 65);
+    EXPECT_FALSE(bitmap.Test(65));
+}
+
+TEST(ValidityBitmap, FindNext_SkipsEmptyWords)
+{
+    ValidityBitmap bitmap(300);
+    bitmap.Set(3);
+    bitmap.Set(250);
+
+    EXPECT_EQ(bitmap.FindNext(0), 3);
+    EXPECT_EQ(bitmap.FindNext(4), 250);
+    EXPECT_EQ(bitmap.FindNext(251), 300);
+}
+#pragma endregion
+
+#pragma region OptionVector::push_back
+TEST(OptionVector, PushBack)
+{
+    OptionVector<int> vector;
+    vector.push_back(Some(1));
+    vector.push_back(None);
+    vector.push_back(3);
+
+    EXPECT_EQ(vector.size(), 3);
+    EXPECT_EQ(vector[0], Some(1));
+    EXPECT_EQ(vector[1], None);
+    EXPECT_EQ(vector[2], Some(3));
+}
+
+TEST(OptionVector, PushBack_MovesValue)
+{
+    OptionVector<std::string> vector;
+    vector.push_back(Some(std::string("hello")));
+    vector.push_back(NoneT<std::string>());
+
+    EXPECT_EQ(*vector[0], "hello");
+    EXPECT_TRUE(vector[1].IsNone());
+}
+#pragma endregion
+
+#pragma region OptionVector::operator[]
+TEST(OptionVector, Index_RefersInPlace)
+{
+    OptionVector<int> vector{Some(1), None};
+
+    *vector[0] = 42;
+
+    EXPECT_EQ(vector[0], Some(42));
+    EXPECT_EQ(vector.Values()[0], 42);
+    EXPECT_THROW(vector[1].Unwrap(), SomeExpectedException);
+    EXPECT_EQ(vector[1].UnwrapOr(7), 7);
+}
+
+TEST(OptionVector, SetAndTake)
+{
+    OptionVector<int> vector(2);
+    vector.Set(1, 5);
+
+    EXPECT_TRUE(vector.IsNone(0));
+    EXPECT_TRUE(vector.IsSome(1));
+    EXPECT_EQ(vector.Take(1), Some(5));
+    EXPECT_EQ(vector.Take(1), None);
+    EXPECT_TRUE(vector.IsNone(1));
+}
+#pragma endregion
+
+#pragma region OptionVector::CountSome
+TEST(OptionVector, CountSome)
+{
+    OptionVector<double> vector;
+    for (int i = 0; i < 1000; ++i)
+    {
+        if (i % 4 == 0)
+            vector.push_back(i * 0.5);
+        else
+            vector.PushNone();
+    }
+
+    EXPECT_EQ(vector.CountSome(), 250);
+    EXPECT_EQ(vector.CountNone(), 750);
+}
+#pragma endregion
+
+#pragma region OptionVector::Iteration
+TEST(OptionVector, Iterate_All)
+{
+    OptionVector<int> const vector{Some(1), None, Some(3)};
+
+    std::vector<Option<int>> actual;
+    for (OptionRef<int const> element : vector) actual.push_back(element.Cloned());
+
+    std::vector<Option<int>> expected{Some(1), None, Some(3)};
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(OptionVector, Iterate_Somes)
+{
+    OptionVector<int> vector(500);
+    vector.Set(2, 20);
+    vector.Set(130, 1300);
+    vector.Set(499, 4990);
+
+    std::vector<int> values;
+    for (int value : vector.Somes()) values.push_back(value);
+
+    std::vector<std::size_t> indices;
+    vector.ForEachSome([&](std::size_t i, int const&) { indices.push_back(i); });
+
+    EXPECT_EQ(values, (std::vector<int>{20, 1300, 4990}));
+    EXPECT_EQ(indices, (std::vector<std::size_t>{2, 130, 499}));
+}
+
+TEST(OptionVector, Iterate_Somes_Empty)
+{
+    OptionVector<int> const vector(100);
+
+    EXPECT_EQ(vector.Somes().begin(), vector.Somes().end());
+}
+#pragma endregion
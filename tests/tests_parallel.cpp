@@ -0,0 +1,139 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Parallel.h"
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/Task.h"
+#include "../include/CppResultOption/ThreadPool.h"
+
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+std::vector<int> MakeInputs(int count)
+{
+    std::vector<int> inputs(count);
+    std::iota(inputs.begin(), inputs.end(), 0);
+    return inputs;
+}
+
+} // namespace
+
+#pragma region ParallelTryTransform
+TEST(Parallel, TryTransform_AllOk)
+{
+    std::vector<int> const inputs = MakeInputs(100000);
+
+    auto const actual = ParallelTryTransform(ParallelPolicy{.threads = 4, .chunkSize = 1000}, inputs,
+                                             [](int x) { return Ok<long, std::string>(2L * x); });
+
+    ASSERT_TRUE(actual.IsOk());
+    std::vector<long> const& values = actual.Unwrap();
+    ASSERT_EQ(values.size(), inputs.size());
+    for (std::size_t i = 0; i < values.size(); ++i) ASSERT_EQ(values[i], 2L * inputs[i]);
+}
+
+TEST(Parallel, TryTransform_FirstErrorByIndex)
+{
+    std::vector<int> const inputs = MakeInputs(100000);
+
+    for (int run = 0; run < 10; ++run)
+    {
+        auto const actual = ParallelTryTransform(ParallelPolicy{.threads = 8, .chunkSize = 64}, inputs,
+                                                 [](int x)
+                                                 {
+                                                     if (x % 7919 == 7918) return Err<int, std::string>(std::to_string(x));
+                                                     return Ok<int, std::string>(x);
+                                                 });
+
+        EXPECT_EQ(actual.UnwrapErr(), "7918");
+    }
+}
+
+TEST(Parallel, TryTransform_StopsAfterError)
+{
+    std::vector<int> const inputs = MakeInputs(1000000);
+    std::atomic<std::size_t> calls{0};
+
+    auto const actual = ParallelTryTransform(ParallelPolicy{.threads = 4, .chunkSize = 100}, inputs,
+                                             [&](int x)
+                                             {
+                                                 calls.fetch_add(1, std::memory_order_relaxed);
+                                                 if (x == 10) return Err<int, int>(x);
+                                                 return Ok<int, int>(x);
+                                             });
+
+    EXPECT_EQ(actual.UnwrapErr(), 10);
+    EXPECT_LT(calls.load(), inputs.size() / 2);
+}
+
+TEST(Parallel, TryTransform_Empty)
+{
+    std::vector<int> const inputs;
+
+    auto const actual = ParallelTryTransform(inputs, [](int x) { return Ok<int, int>(x); });
+
+    EXPECT_TRUE(actual.Unwrap().empty());
+}
+
+TEST(Parallel, TryTransform_RethrowsException)
+{
+    std::vector<int> const inputs = MakeInputs(1000);
+
+    auto throwing = [](int x)
+    {
+        if (x == 500) throw std::logic_error("boom");
+        return Ok<int, int>(x);
+    };
+
+    EXPECT_THROW(ParallelTryTransform(ParallelPolicy{.threads = 3, .chunkSize = 10}, inputs, throwing),
+                 std::logic_error);
+}
+
+TEST(Parallel, TryTransform_RunsOnPool)
+{
+    ThreadPool pool(3);
+    std::vector<int> const inputs = MakeInputs(10000);
+    std::thread::id const caller = std::this_thread::get_id();
+    std::atomic<bool> foreignThread{false};
+
+    auto const actual = ParallelTryTransform(ParallelPolicy{.pool = &pool, .chunkSize = 10}, inputs,
+                                             [&](int x)
+                                             {
+                                                 if (!pool.InWorker() && std::this_thread::get_id() != caller)
+                                                     foreignThread.store(true);
+                                                 return Ok<int, int>(x);
+                                             });
+
+    EXPECT_EQ(actual.Unwrap().size(), inputs.size());
+    EXPECT_FALSE(foreignThread.load());
+}
+
+TEST(Parallel, TryTransform_NestedInWorker)
+{
+    ThreadPool pool(1);
+    std::vector<int> const inputs = MakeInputs(1000);
+
+    // The only worker is the caller, so it must run its own posted chunks.
+    auto outer = Spawn(pool,
+                       [&]
+                       {
+                           return ParallelTryTransform(ParallelPolicy{.pool = &pool, .threads = 4, .chunkSize = 10},
+                                                       inputs, [](int x) { return Ok<int, int>(x + 1); });
+                       });
+
+    EXPECT_EQ(std::move(outer).Get().Unwrap().back(), 1000);
+}
+#pragma endregion
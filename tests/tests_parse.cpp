@@ -0,0 +1,129 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Parse.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region Parse
+TEST(Parse, Integers)
+{
+    EXPECT_EQ(Parse<int>("42").Unwrap(), 42);
+    EXPECT_EQ(Parse<int>("-17").Unwrap(), -17);
+    EXPECT_EQ(Parse<int>("+8").Unwrap(), 8);
+    EXPECT_EQ(Parse<std::uint8_t>("255").Unwrap(), 255);
+}
+
+TEST(Parse, IntegerErrors)
+{
+    EXPECT_EQ(Parse<int>("").UnwrapErr(), (ParseError{ParseReason::Empty, 0}));
+    EXPECT_EQ(Parse<int>("x1").UnwrapErr(), (ParseError{ParseReason::InvalidCharacter, 0}));
+    EXPECT_EQ(Parse<int>("+-1").UnwrapErr(), (ParseError{ParseReason::InvalidCharacter, 0}));
+    EXPECT_EQ(Parse<int>("12ab").UnwrapErr(), (ParseError{ParseReason::TrailingCharacters, 2}));
+    EXPECT_EQ(Parse<std::uint8_t>("256").UnwrapErr(), (ParseError{ParseReason::OutOfRange, 0}));
+    EXPECT_EQ(Parse<std::uint8_t>("+256").UnwrapErr(), (ParseError{ParseReason::OutOfRange, 1}));
+    EXPECT_EQ(Parse<unsigned>("-1").UnwrapErr().reason, ParseReason::InvalidCharacter);
+}
+
+TEST(Parse, Floating)
+{
+    EXPECT_DOUBLE_EQ(Parse<double>("3.25").Unwrap(), 3.25);
+    EXPECT_DOUBLE_EQ(Parse<double>("-1e3").Unwrap(), -1000.0);
+    EXPECT_FLOAT_EQ(Parse<float>("+0.5").Unwrap(), 0.5f);
+    EXPECT_TRUE(std::isinf(Parse<double>("inf").Unwrap()));
+    EXPECT_EQ(Parse<double>("1.5.2").UnwrapErr(), (ParseError{ParseReason::TrailingCharacters, 3}));
+    EXPECT_EQ(Parse<double>("1e999").UnwrapErr().reason, ParseReason::OutOfRange);
+}
+
+TEST(Parse, Bases)
+{
+    EXPECT_EQ(ParseInteger<int>("1011", 2).Unwrap(), 11);
+    EXPECT_EQ(ParseInteger<int>("z", 36).Unwrap(), 35);
+    EXPECT_EQ(ParseHex<std::uint32_t>("ff").Unwrap(), 255u);
+    EXPECT_EQ(ParseHex<std::uint32_t>("0XdeadBEEF").Unwrap(), 0xdeadbeefu);
+    EXPECT_EQ(ParseHex<int>("0x1g").UnwrapErr(), (ParseError{ParseReason::TrailingCharacters, 3}));
+    EXPECT_EQ(ParseHex<std::uint8_t>("0x100").UnwrapErr(), (ParseError{ParseReason::OutOfRange, 2}));
+    EXPECT_EQ(ParseHex<int>("-ff").Unwrap(), -255);
+}
+
+TEST(Parse, BaseErrors)
+{
+    EXPECT_EQ(ParseInteger<int>("10", 1).UnwrapErr(), (ParseError{ParseReason::InvalidBase, 0}));
+    EXPECT_EQ(ParseInteger<int>("10", 37).UnwrapErr(), (ParseError{ParseReason::InvalidBase, 0}));
+    EXPECT_EQ(ParseInteger<int>("", 0).UnwrapErr(), (ParseError{ParseReason::InvalidBase, 0}));
+    EXPECT_EQ(ParseHex<int>("0x-5").UnwrapErr(), (ParseError{ParseReason::InvalidCharacter, 2}));
+    EXPECT_EQ(ParseHex<int>("0x+5").UnwrapErr(), (ParseError{ParseReason::InvalidCharacter, 2}));
+}
+
+TEST(Parse, Bool)
+{
+    EXPECT_TRUE(ParseBool("true").Unwrap());
+    EXPECT_TRUE(ParseBool("1").Unwrap());
+    EXPECT_FALSE(ParseBool("false").Unwrap());
+    EXPECT_FALSE(ParseBool("0").Unwrap());
+    EXPECT_EQ(ParseBool("yes").UnwrapErr().reason, ParseReason::InvalidCharacter);
+    EXPECT_EQ(ParseBool("").UnwrapErr().reason, ParseReason::Empty);
+}
+#pragma endregion
+
+#pragma region ParseColumn
+TEST(ParseColumn, MarksFailuresNone)
+{
+    std::array<std::string_view, 4> const input{"1", "", "x", "4"};
+    std::vector<Option<int>> output(input.size());
+
+    EXPECT_EQ(ParseColumn<int>(input, output), 1u);
+    EXPECT_EQ(output[0].Unwrap(), 1);
+    EXPECT_TRUE(output[1].IsNone());
+    EXPECT_TRUE(output[2].IsNone());
+    EXPECT_EQ(output[3].Unwrap(), 4);
+}
+#pragma endregion
+
+#pragma region SplitFields
+TEST(SplitFields, YieldsOptionPerField)
+{
+    std::vector<Option<std::string_view>> fields;
+    for (Option<std::string_view> field : SplitFields("a,,c,", ','))
+        fields.push_back(field);
+
+    ASSERT_EQ(fields.size(), 4u);
+    EXPECT_EQ(fields[0].Unwrap(), "a");
+    EXPECT_TRUE(fields[1].IsNone());
+    EXPECT_EQ(fields[2].Unwrap(), "c");
+    EXPECT_TRUE(fields[3].IsNone());
+}
+
+TEST(SplitFields, Index)
+{
+    SplitFields const fields("7|name|31", '|');
+
+    EXPECT_EQ(fields[1].Unwrap(), "name");
+    EXPECT_TRUE(fields[3].IsNone());
+    EXPECT_EQ(fields[2].AndThen<int>([](std::string_view age) { return Parse<int>(age).Ok(); }).Unwrap(), 31);
+}
+
+TEST(SplitFields, EmptyLineIsOneNoneField)
+{
+    std::size_t count = 0;
+    for (Option<std::string_view> field : SplitFields("", ','))
+    {
+        EXPECT_TRUE(field.IsNone());
+        ++count;
+    }
+
+    EXPECT_EQ(count, 1u);
+}
+#pragma endregion
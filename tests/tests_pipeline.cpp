@@ -0,0 +1,197 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Pipeline.h"
+#include "../include/CppResultOption/Result.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+Result<int, std::string> RejectMultiplesOfFive(int value)
+{
+    if (value % 5 == 0) return Err<int, std::string>("multiple of five: " + std::to_string(value));
+    return Ok<int, std::string>(value);
+}
+
+} // namespace
+
+#pragma region Pipeline
+TEST(Pipeline, MapsAndRoutesErrors)
+{
+    std::vector<int> received;
+    std::vector<std::string> rejected;
+    std::vector<std::string> rejectedStages;
+
+    {
+        Pipeline<int, std::string> pipeline = MakePipeline<int, std::string>({.batchSize = 4, .queueCapacity = 2})
+                                                  .Stage("filter", RejectMultiplesOfFive)
+                                                  .Stage("double", [](int value) { return value * 2; })
+                                                  .Build([&](int value) { received.push_back(value); },
+                                                         [&](DeadLetter<std::string> letter)
+                                                         {
+                                                             rejectedStages.emplace_back(letter.stage);
+                                                             rejected.push_back(std::move(letter.error));
+                                                         });
+
+        std::vector<int> values(20);
+        std::iota(values.begin(), values.end(), 1);
+        EXPECT_EQ(pipeline.Feed(values), 20);
+    }
+
+    std::vector<int> expected;
+    for (int i = 1; i <= 20; ++i)
+        if (i % 5 != 0) expected.push_back(i * 2);
+
+    EXPECT_EQ(received, expected);
+    EXPECT_EQ(rejected, (std::vector<std::string>{"multiple of five: 5", "multiple of five: 10",
+                                                  "multiple of five: 15", "multiple of five: 20"}));
+    EXPECT_TRUE(std::all_of(rejectedStages.begin(), rejectedStages.end(),
+                            [](std::string const& stage) { return stage == "filter"; }));
+}
+
+TEST(Pipeline, FusedStageSharesThread)
+{
+    std::atomic<int> sum{0};
+    std::mutex idsMutex;
+    std::vector<std::thread::id> parseThreads;
+    std::vector<std::thread::id> squareThreads;
+
+    {
+        auto pipeline = MakePipeline<std::string, std::string>({.batchSize = 3})
+                            .Stage("parse",
+                                   [&](std::string text) -> Result<int, std::string>
+                                   {
+                                       std::lock_guard lock(idsMutex);
+                                       parseThreads.push_back(std::this_thread::get_id());
+                                       if (text.empty()) return Err<int, std::string>("empty");
+                                       return Ok<int, std::string>(std::stoi(text));
+                                   })
+                            .Stage(
+                                "square",
+                                [&](int value)
+                                {
+                                    std::lock_guard lock(idsMutex);
+                                    squareThreads.push_back(std::this_thread::get_id());
+                                    return value * value;
+                                },
+                                {.dedicatedThread = false})
+                            .Build([&](int value) { sum += value; }, [](DeadLetter<std::string>) {});
+
+        pipeline.Feed(std::vector<std::string>{"1", "2", "", "3"});
+    }
+
+    EXPECT_EQ(sum.load(), 14);
+    ASSERT_EQ(squareThreads.size(), 3);
+    EXPECT_TRUE(std::all_of(squareThreads.begin(), squareThreads.end(),
+                            [&](std::thread::id id) { return id == parseThreads.front(); }));
+}
+
+TEST(Pipeline, SinkErrorsAreDiverted)
+{
+    std::vector<std::string> stages;
+
+    {
+        auto pipeline = MakePipeline<int, std::string>().Build(
+            [](int value) -> Result<std::monostate, std::string>
+            {
+                if (value < 0) return Err<std::monostate, std::string>("negative");
+                return Ok<std::monostate, std::string>(std::monostate());
+            },
+            [&](DeadLetter<std::string> letter) { stages.emplace_back(letter.stage); });
+
+        pipeline.Feed(std::vector<int>{1, -1, 2, -2});
+    }
+
+    EXPECT_EQ(stages, (std::vector<std::string>{"sink", "sink"}));
+}
+
+TEST(Pipeline, Metrics)
+{
+    auto pipeline = MakePipeline<int, std::string>({.batchSize = 8})
+                        .Stage("filter", RejectMultiplesOfFive)
+                        .Build([](int) {}, [](DeadLetter<std::string>) {});
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 1);
+    pipeline.Feed(values);
+    pipeline.Join();
+
+    std::vector<StageMetrics> const metrics = pipeline.Metrics();
+
+    ASSERT_EQ(metrics.size(), 2);
+    EXPECT_EQ(metrics[0].name, "filter");
+    EXPECT_EQ(metrics[0].processed, 100);
+    EXPECT_EQ(metrics[0].failed, 20);
+    EXPECT_EQ(metrics[0].queueDepth, 0);
+    EXPECT_EQ(metrics[1].name, "sink");
+    EXPECT_EQ(metrics[1].processed, 80);
+    EXPECT_EQ(metrics[1].failed, 0);
+}
+
+TEST(Pipeline, BackpressureKeepsEverything)
+{
+    constexpr int Count = 20000;
+    long sum = 0;
+
+    {
+        auto pipeline = MakePipeline<int, std::string>({.batchSize = 16, .queueCapacity = 2})
+                            .Stage("increment", [](int value) { return value + 1; })
+                            .Stage("slow",
+                                   [](int value)
+                                   {
+                                       if (value % 1000 == 0) std::this_thread::yield();
+                                       return value;
+                                   })
+                            .Build([&](int value) { sum += value; }, [](DeadLetter<std::string>) {});
+
+        std::vector<int> values(Count);
+        std::iota(values.begin(), values.end(), 0);
+        EXPECT_EQ(pipeline.Feed(values), Count);
+    }
+
+    EXPECT_EQ(sum, static_cast<long>(Count) * (Count + 1) / 2);
+}
+
+TEST(Pipeline, SendAfterCloseHandsBackBatch)
+{
+    auto pipeline = MakePipeline<int, std::string>().Build([](int) {}, [](DeadLetter<std::string>) {});
+    pipeline.Close();
+
+    auto const sent = pipeline.Send({1, 2, 3});
+
+    ASSERT_TRUE(sent.IsErr());
+    EXPECT_EQ(sent.UnwrapErr().reason, ChannelError::Closed);
+    EXPECT_EQ(sent.UnwrapErr().value, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(Pipeline, MoveAssignDrainsPrevious)
+{
+    std::atomic<int> first{0};
+    std::atomic<int> second{0};
+
+    auto pipeline = MakePipeline<int, std::string>().Stage("pass", [](int value) { return value; }).Build(
+        [&](int value) { first += value; }, [](DeadLetter<std::string>) {});
+    pipeline.Send({1, 2, 3});
+
+    pipeline = MakePipeline<int, std::string>().Build([&](int value) { second += value; },
+                                                      [](DeadLetter<std::string>) {});
+    EXPECT_EQ(first, 6);
+
+    pipeline.Send({4});
+    pipeline.Join();
+    EXPECT_EQ(second, 4);
+}
+#pragma endregion
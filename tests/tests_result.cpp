@@ -0,0 +1,72 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Result.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region Expect
+TEST(Result, Expect_LvalueIsMutable)
+{
+    Result<std::string, std::string> ok(OkTag, "a");
+    ok.Expect("ok") += "b";
+
+    Result<int, std::string> err(ErrTag, "c");
+    err.ExpectErr("err") += "d";
+
+    EXPECT_EQ(ok.Unwrap(), "ab");
+    EXPECT_EQ(err.UnwrapErr(), "cd");
+}
+#pragma endregion
+
+#pragma region Operators
+TEST(Result, OperatorOr)
+{
+    Result<int, std::string> const ok(OkTag, 1);
+    Result<int, std::string> const err(ErrTag, "e");
+    Result<int, std::string> const other(OkTag, 2);
+
+    EXPECT_EQ((ok | other).Unwrap(), 1);
+    EXPECT_EQ((err | other).Unwrap(), 2);
+    EXPECT_EQ((err | err).UnwrapErr(), "e");
+}
+
+TEST(Result, ExternInstantiations)
+{
+    Result<int, std::runtime_error> const ok(OkTag, 4);
+    Result<std::string, std::runtime_error> const err(ErrTag, std::runtime_error("boom"));
+
+    EXPECT_EQ(ok.Unwrap(), 4);
+    EXPECT_STREQ(err.UnwrapErr().what(), "boom");
+}
+#pragma endregion
+
+#ifdef __cpp_lib_expected
+#pragma region Std
+TEST(Result, Std_RoundTrip)
+{
+    EXPECT_EQ((FromStd(std::expected<int, std::string>(1)).Unwrap()), 1);
+    EXPECT_EQ((FromStd(std::expected<int, std::string>(std::unexpect, "e")).UnwrapErr()), "e");
+    EXPECT_EQ((Result<int, std::string>(OkTag, 2).ToStd()), (std::expected<int, std::string>(2)));
+    EXPECT_EQ((Result<int, std::string>(ErrTag, "f").ToStd().error()), "f");
+}
+
+TEST(Result, Std_Moves)
+{
+    using Pointer = std::unique_ptr<int>;
+
+    Result<Pointer, std::string> a = FromStd(std::expected<Pointer, std::string>(std::make_unique<int>(7)));
+    std::expected<Pointer, std::string> b = std::move(a).ToStd();
+
+    EXPECT_EQ(**b, 7);
+}
+#pragma endregion
+#endif
@@ -0,0 +1,118 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/ResultVector.h"
+
+#include <ranges>
+#include <span>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+std::vector<Result<int, std::string>> MakeBatch()
+{
+    std::vector<Result<int, std::string>> batch;
+    for (int i = 0; i < 200; ++i)
+    {
+        if (i % 50 == 7)
+            batch.push_back(Err<int, std::string>("bad " + std::to_string(i)));
+        else
+            batch.push_back(Ok<int, std::string>(i));
+    }
+    return batch;
+}
+
+} // namespace
+
+#pragma region ResultVector::push_back
+TEST(ResultVector, PushBack)
+{
+    ResultVector<int, std::string> vector;
+    vector.push_back(Ok<int, std::string>(1));
+    vector.PushErr("boom");
+    vector.PushOk(3);
+
+    EXPECT_EQ(vector.size(), 3);
+    EXPECT_TRUE(vector.IsOk(0));
+    EXPECT_TRUE(vector.IsErr(1));
+    EXPECT_EQ(vector.Ok(0), Some(1));
+    EXPECT_EQ(vector.Ok(1), None);
+    EXPECT_EQ(*vector.Err(1), "boom");
+    EXPECT_EQ(vector.Err(2), None);
+    EXPECT_EQ(vector.Get(1), (Err<int, std::string>("boom")));
+}
+#pragma endregion
+
+#pragma region ResultVector::Append
+TEST(ResultVector, Append_Counts)
+{
+    ResultVector<int, std::string> vector;
+    vector.Append(MakeBatch());
+
+    EXPECT_EQ(vector.size(), 200);
+    EXPECT_EQ(vector.ErrCount(), 4);
+    EXPECT_EQ(vector.OkCount(), 196);
+    EXPECT_FALSE(vector.AllOk());
+    EXPECT_EQ(*vector.Err(157), "bad 157");
+}
+
+TEST(ResultVector, Append_ViewsLeaveSourceIntact)
+{
+    std::vector<Result<std::string, std::string>> source;
+    source.push_back(Ok<std::string, std::string>("first"));
+    source.push_back(Err<std::string, std::string>("second"));
+
+    ResultVector<std::string, std::string> vector;
+    vector.Append(std::span(source));
+    vector.Append(source | std::views::all);
+
+    EXPECT_EQ(vector.size(), 4);
+    EXPECT_EQ(*vector.Ok(2), "first");
+    EXPECT_EQ(*vector.Err(3), "second");
+    EXPECT_EQ(source[0].Unwrap(), "first");
+    EXPECT_EQ(source[1].UnwrapErr(), "second");
+}
+#pragma endregion
+
+#pragma region ResultVector::Iteration
+TEST(ResultVector, Iterate_OksAndErrs)
+{
+    ResultVector<int, std::string> const vector(MakeBatch());
+
+    int sum = 0;
+    std::size_t oks = 0;
+    for (int value : vector.Oks())
+    {
+        sum += value;
+        ++oks;
+    }
+
+    std::vector<std::size_t> errPositions;
+    for (auto const& [position, err] : vector.Errs()) errPositions.push_back(position);
+
+    EXPECT_EQ(oks, 196);
+    EXPECT_EQ(sum, 199 * 200 / 2 - (7 + 57 + 107 + 157));
+    EXPECT_EQ(errPositions, (std::vector<std::size_t>{7, 57, 107, 157}));
+}
+#pragma endregion
+
+#pragma region ResultVector::ToResults
+TEST(ResultVector, RoundTrip)
+{
+    std::vector<Result<int, std::string>> const batch = MakeBatch();
+    ResultVector<int, std::string> vector(batch);
+
+    EXPECT_EQ(vector.ToResults(), batch);
+    EXPECT_EQ(std::move(vector).ToResults(), batch);
+}
+#pragma endregion
@@ -0,0 +1,116 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/OptionVector.h"
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/ResultVector.h"
+#include "../include/CppResultOption/SortKernels.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+template<typename T>
+std::vector<Option<T>> MakeOptions()
+{
+    std::vector<Option<T>> options;
+    for (int i = 0; i < 500; ++i)
+    {
+        if (i % 7 == 3)
+            options.push_back(NoneT<T>());
+        else
+            options.push_back(Some(static_cast<T>((i * 7919) % 1000 - 500) / static_cast<T>(i % 2 ? 1 : 4)));
+    }
+    return options;
+}
+
+template<typename T, NonePlacement Placement>
+void ExpectSortMatchesStdSort()
+{
+    std::vector<Option<T>> expected = MakeOptions<T>();
+    OptionVector<T> column;
+    for (Option<T> const& option : expected) column.push_back(option);
+
+    std::stable_sort(expected.begin(), expected.end(), OptionLess<Placement>());
+    Kernels::Sort(column, Placement);
+
+    ASSERT_EQ(column.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) EXPECT_EQ(column[i], expected[i]) << i;
+}
+
+} // namespace
+
+#pragma region Kernels::Sort
+TEST(Kernels, Sort_Int64_NoneLast)
+{
+    ExpectSortMatchesStdSort<std::int64_t, NonePlacement::Last>();
+}
+
+TEST(Kernels, Sort_Int32_NoneFirst)
+{
+    ExpectSortMatchesStdSort<std::int32_t, NonePlacement::First>();
+}
+
+TEST(Kernels, Sort_Double_NoneLast)
+{
+    ExpectSortMatchesStdSort<double, NonePlacement::Last>();
+}
+
+TEST(Kernels, ArgSort_IsStable)
+{
+    OptionVector<int> const column{Some(2), None, Some(1), Some(2), None, Some(-5)};
+
+    EXPECT_EQ(Kernels::ArgSort(column), (std::vector<std::size_t>{5, 2, 0, 3, 1, 4}));
+    EXPECT_EQ(Kernels::ArgSort(column, NonePlacement::First), (std::vector<std::size_t>{1, 4, 5, 2, 0, 3}));
+}
+#pragma endregion
+
+#pragma region Kernels::LowerBound
+TEST(Kernels, LowerBound_NonePlacement)
+{
+    OptionVector<int> last{Some(5), None, Some(1), Some(3), Some(3)};
+    OptionVector<int> first = last;
+    Kernels::Sort(last, NonePlacement::Last);
+    Kernels::Sort(first, NonePlacement::First);
+
+    EXPECT_EQ(Kernels::LowerBound(last, 3), 1);
+    EXPECT_EQ(Kernels::UpperBound(last, 3), 3);
+    EXPECT_EQ(Kernels::LowerBound(last, 9), 4);
+    EXPECT_EQ(Kernels::LowerBound(first, 3, NonePlacement::First), 2);
+    EXPECT_EQ(Kernels::LowerBound(first, 0, NonePlacement::First), 1);
+}
+#pragma endregion
+
+#pragma region Kernels::GroupErrsBy
+TEST(Kernels, GroupErrsBy)
+{
+    std::vector<Result<int, int>> results;
+    for (int i = 0; i < 20; ++i)
+    {
+        if (i % 5 == 0)
+            results.push_back(Err<int, int>(i % 2 ? 404 : 500));
+        else
+            results.push_back(Ok<int, int>(i));
+    }
+
+    auto identity = [](int code) { return code; };
+    auto const fromVector = Kernels::GroupErrsBy(results, identity);
+    auto const fromColumns = Kernels::GroupErrsBy(ResultVector<int, int>(results), identity);
+
+    EXPECT_EQ(fromVector.size(), 2);
+    EXPECT_EQ(fromVector.at(500), (std::vector<std::size_t>{0, 10}));
+    EXPECT_EQ(fromVector.at(404), (std::vector<std::size_t>{5, 15}));
+    EXPECT_EQ(fromColumns, fromVector);
+}
+#pragma endregion
@@ -0,0 +1,154 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/Task.h"
+#include "../include/CppResultOption/ThreadPool.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <memory>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+#pragma region ThreadPool
+TEST(ThreadPool, RunsEveryJob)
+{
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(4);
+        for (int i = 0; i < 1000; ++i) pool.Post([&] { ++done; });
+    }
+
+    EXPECT_EQ(done.load(), 1000);
+}
+
+TEST(ThreadPool, NestedPostsAreStolen)
+{
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(4);
+        pool.Post(
+            [&]
+            {
+                for (int i = 0; i < 100; ++i) pool.Post([&] { ++done; });
+            });
+    }
+
+    EXPECT_EQ(done.load(), 100);
+}
+#pragma endregion
+
+#pragma region Task
+TEST(Task, Ready_ThenRunsInline)
+{
+    Task<Result<int, std::string>> task(Ok<int, std::string>(20));
+
+    auto next = std::move(task).Then([](int x) { return x + 1; });
+
+    EXPECT_TRUE(next.IsReady());
+    EXPECT_EQ(std::move(next).Get().Unwrap(), 21);
+}
+
+TEST(Task, Ready_MoveOnlyPayload)
+{
+    using Boxed = Result<std::unique_ptr<int>, std::string>;
+    Task<Boxed> task(Boxed(OkTag, std::make_unique<int>(4)));
+
+    auto next = std::move(task)
+                    .Then([](std::unique_ptr<int>&& value) { return std::make_unique<int>(*value * 2); })
+                    .MapErr([](std::string&& err) { return err.size(); });
+
+    EXPECT_TRUE(next.IsReady());
+    EXPECT_EQ(*std::move(next).Get().Unwrap(), 8);
+}
+
+TEST(Task, Spawn_Get)
+{
+    ThreadPool pool(2);
+
+    auto task = Spawn(pool, [] { return Ok<int, std::string>(42); });
+
+    EXPECT_EQ(std::move(task).Get().Unwrap(), 42);
+}
+
+TEST(Task, Then_AndThenSemantics)
+{
+    ThreadPool pool(2);
+    int skipped = 0;
+
+    auto task = Spawn(pool, [] { return Ok<int, std::string>(3); })
+                    .Then([](int x) { return x % 2 ? Err<int, std::string>("odd") : Ok<int, std::string>(x); })
+                    .Then(
+                        [&](int x)
+                        {
+                            ++skipped;
+                            return x * 10;
+                        });
+
+    EXPECT_EQ(std::move(task).Get().UnwrapErr(), "odd");
+    EXPECT_EQ(skipped, 0);
+}
+
+TEST(Task, MapErr)
+{
+    ThreadPool pool(2);
+
+    auto task = Spawn(pool, [] { return Err<int, std::string>("timeout"); })
+                    .MapErr([](std::string const& e) { return static_cast<int>(e.size()); });
+
+    EXPECT_EQ(std::move(task).Get().UnwrapErr(), 7);
+}
+
+TEST(Task, Cancelled)
+{
+    ThreadPool pool(1);
+    std::stop_source source;
+    source.request_stop();
+    bool ran = false;
+
+    auto task = Spawn(pool, source.get_token(),
+                      [&]
+                      {
+                          ran = true;
+                          return Ok<int, std::runtime_error>(1);
+                      });
+
+    EXPECT_TRUE(std::move(task).Get().IsErr());
+    EXPECT_FALSE(ran);
+}
+
+TEST(Task, JoinInsideWorkerHelps)
+{
+    ThreadPool pool(1);
+
+    auto outer = Spawn(pool,
+                       [&]
+                       {
+                           // With one worker, a blocking join here would deadlock; Get runs the inner job instead.
+                           auto inner = Spawn(pool, [] { return Ok<int, std::string>(5); });
+                           return Ok<int, std::string>(std::move(inner).Get().Unwrap() * 2);
+                       });
+
+    EXPECT_EQ(std::move(outer).Get().Unwrap(), 10);
+}
+
+TEST(Task, ManySpawns)
+{
+    ThreadPool pool(4);
+    std::vector<Task<Result<int, std::string>>> tasks;
+    for (int i = 0; i < 500; ++i) tasks.push_back(Spawn(pool, [i] { return Ok<int, std::string>(i); }));
+
+    long sum = 0;
+    for (auto& task : tasks) sum += std::move(task).Get().Unwrap();
+
+    EXPECT_EQ(sum, 500L * 499 / 2);
+}
+#pragma endregion
@@ -0,0 +1,199 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/Task.h"
+#include "../include/CppResultOption/TaskCombinators.h"
+#include "../include/CppResultOption/ThreadPool.h"
+
+#include <chrono>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+using IntTask = Task<Result<int, std::string>>;
+
+IntTask Delayed(ThreadPool& pool, Result<int, std::string> result, int milliseconds, std::stop_token token = {})
+{
+    return Spawn(pool,
+                 [result, milliseconds, token]
+                 {
+                     for (int waited = 0; waited < milliseconds && !token.stop_requested(); ++waited)
+                         std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+                     return token.stop_requested() ? Err<int, std::string>("cancelled") : result;
+                 });
+}
+
+std::vector<IntTask> MakeTasks(ThreadPool& pool, std::vector<Result<int, std::string>> const& results,
+                               std::stop_token token = {})
+{
+    std::vector<IntTask> tasks;
+    int delay = 0;
+    for (auto const& result : results) tasks.push_back(Delayed(pool, result, delay += 2, token));
+    return tasks;
+}
+
+} // namespace
+
+#pragma region WhenAll
+TEST(TaskCombinators, WhenAll_Ok)
+{
+    ThreadPool pool(4);
+
+    auto all = WhenAll(MakeTasks(pool, {Ok<int, std::string>(1), Ok<int, std::string>(2), Ok<int, std::string>(3)}));
+
+    EXPECT_EQ(std::move(all).Get().Unwrap(), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(TaskCombinators, WhenAll_CollectsErrors)
+{
+    ThreadPool pool(4);
+
+    auto all =
+        WhenAll(MakeTasks(pool, {Err<int, std::string>("a"), Ok<int, std::string>(2), Err<int, std::string>("c")}));
+
+    EXPECT_EQ(std::move(all).Get().UnwrapErr(), (std::vector<std::string>{"a", "c"}));
+}
+
+TEST(TaskCombinators, WhenAll_ReadyInputs)
+{
+    std::vector<IntTask> tasks;
+    tasks.emplace_back(Ok<int, std::string>(4));
+    tasks.emplace_back(Ok<int, std::string>(5));
+
+    auto all = WhenAll(std::move(tasks));
+
+    EXPECT_TRUE(all.IsReady());
+    EXPECT_EQ(std::move(all).Get().Unwrap(), (std::vector<int>{4, 5}));
+}
+
+TEST(TaskCombinators, WhenAll_ReadyFirstInsideWorker)
+{
+    ThreadPool pool(1);
+
+    // The only worker waits on the combinator, so it must run the spawned input itself.
+    auto outer = Spawn(pool,
+                       [&pool]
+                       {
+                           std::vector<IntTask> tasks;
+                           tasks.emplace_back(Ok<int, std::string>(1));
+                           tasks.push_back(Delayed(pool, Ok<int, std::string>(2), 1));
+
+                           return WhenAll(std::move(tasks)).Get();
+                       });
+
+    EXPECT_EQ(std::move(outer).Get().Unwrap(), (std::vector<int>{1, 2}));
+}
+#pragma endregion
+
+#pragma region WhenAny
+TEST(TaskCombinators, WhenAny_FirstCompletionWins)
+{
+    ThreadPool pool(4);
+    std::stop_source losers;
+
+    std::vector<IntTask> tasks;
+    tasks.push_back(Delayed(pool, Ok<int, std::string>(1), 2000, losers.get_token()));
+    tasks.push_back(Delayed(pool, Err<int, std::string>("fast failure"), 1, losers.get_token()));
+
+    auto any = WhenAny(std::move(tasks), losers);
+
+    EXPECT_EQ(std::move(any).Get().UnwrapErr(), "fast failure");
+    EXPECT_TRUE(losers.stop_requested());
+}
+#pragma endregion
+
+#pragma region FirstOk
+TEST(TaskCombinators, FirstOk_Hedged)
+{
+    ThreadPool pool(4);
+    std::stop_source losers;
+
+    std::vector<IntTask> tasks;
+    tasks.push_back(Delayed(pool, Err<int, std::string>("replica down"), 1, losers.get_token()));
+    tasks.push_back(Delayed(pool, Ok<int, std::string>(7), 5, losers.get_token()));
+    tasks.push_back(Delayed(pool, Ok<int, std::string>(8), 2000, losers.get_token()));
+
+    auto const start = std::chrono::steady_clock::now();
+    EXPECT_EQ(FirstOk(std::move(tasks), losers).Get().Unwrap(), 7);
+    EXPECT_TRUE(losers.stop_requested());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+}
+
+TEST(TaskCombinators, FirstOk_AllFail)
+{
+    ThreadPool pool(2);
+
+    auto first = FirstOk([&](std::stop_token token)
+                         { return MakeTasks(pool, {Err<int, std::string>("a"), Err<int, std::string>("b")}, token); });
+
+    EXPECT_EQ(std::move(first).Get().UnwrapErr(), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(TaskCombinators, FirstOk_OwnStopSourceCancelsLosers)
+{
+    auto const start = std::chrono::steady_clock::now();
+    {
+        ThreadPool pool(4);
+
+        auto first = FirstOk(
+            [&](std::stop_token token)
+            {
+                std::vector<IntTask> tasks;
+                tasks.push_back(Delayed(pool, Ok<int, std::string>(7), 1, token));
+                tasks.push_back(Delayed(pool, Ok<int, std::string>(8), 2000, token));
+                return tasks;
+            });
+
+        EXPECT_EQ(std::move(first).Get().Unwrap(), 7);
+    }
+
+    // The pool joins its workers on destruction, so an uncancelled loser would hold this scope for two seconds.
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+}
+#pragma endregion
+
+#pragma region Quorum
+TEST(TaskCombinators, Quorum_Reached)
+{
+    ThreadPool pool(4);
+
+    auto quorum = Quorum(2, MakeTasks(pool, {Ok<int, std::string>(1), Err<int, std::string>("b"),
+                                             Ok<int, std::string>(3)}),
+                         std::stop_source(std::nostopstate));
+
+    EXPECT_EQ(std::move(quorum).Get().Unwrap(), (std::vector<int>{1, 3}));
+}
+
+TEST(TaskCombinators, Quorum_Unreachable)
+{
+    ThreadPool pool(4);
+
+    auto quorum = Quorum(2,
+                         [&](std::stop_token token)
+                         {
+                             return MakeTasks(pool,
+                                              {Err<int, std::string>("a"), Err<int, std::string>("b"),
+                                               Ok<int, std::string>(3)},
+                                              token);
+                         });
+
+    EXPECT_EQ(std::move(quorum).Get().UnwrapErr(), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(TaskCombinators, Quorum_Invalid)
+{
+    EXPECT_THROW(Quorum(1, std::vector<IntTask>(), std::stop_source()), std::invalid_argument);
+}
+#pragma endregion
@@ -0,0 +1,156 @@
+﻿//
+// Created by user1 on 18/10/2026.
+//
+
+#include <gtest/gtest.h>
+
+#include "../include/CppResultOption/Option.h"
+#include "../include/CppResultOption/Result.h"
+#include "../include/CppResultOption/Views.h"
+
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace m24;
+using namespace m24::Prelude;
+
+namespace
+{
+
+std::vector<Result<int, std::string>> MakeResults()
+{
+    return {Ok<int, std::string>(1), Err<int, std::string>("a"), Ok<int, std::string>(3), Err<int, std::string>("b")};
+}
+
+template<typename Range>
+auto ToVector(Range&& range)
+{
+    std::vector<std::remove_cvref_t<std::ranges::range_reference_t<Range>>> result;
+    for (auto&& element : range) result.push_back(element);
+    return result;
+}
+
+} // namespace
+
+#pragma region views::somes
+TEST(Views, Somes)
+{
+    std::vector<Option<int>> options{None, Some(1), None, None, Some(2)};
+
+    auto somes = options | views::somes;
+    static_assert(std::ranges::forward_range<decltype(somes)>);
+    static_assert(std::ranges::borrowed_range<decltype(somes)>);
+
+    EXPECT_EQ(ToVector(somes), (std::vector<int>{1, 2}));
+}
+
+TEST(Views, Somes_RefersInPlace)
+{
+    std::vector<Option<int>> options{Some(1), None};
+
+    for (int& value : options | views::somes) value *= 10;
+
+    EXPECT_EQ(options[0], Some(10));
+}
+
+TEST(Views, Somes_FromPrvalues)
+{
+    auto halves = std::views::iota(0) |
+                  std::views::transform([](int i) { return i % 2 ? NoneT<int>() : Some(i / 2); }) | views::somes;
+
+    EXPECT_EQ(ToVector(halves | std::views::take(3)), (std::vector<int>{0, 1, 2}));
+}
+
+TEST(Views, Somes_FromPrvaluesComputesOnce)
+{
+    std::vector<int> const inputs{0, 1, 2, 3};
+    int calls = 0;
+
+    auto halves = inputs |
+                  std::views::transform(
+                      [&calls](int i)
+                      {
+                          ++calls;
+                          return i % 2 ? NoneT<int>() : Some(i / 2);
+                      }) |
+                  views::somes;
+    static_assert(!std::ranges::forward_range<decltype(halves)>);
+
+    EXPECT_EQ(ToVector(halves), (std::vector<int>{0, 1}));
+    EXPECT_EQ(calls, 4);
+}
+#pragma endregion
+
+#pragma region views::oks / views::errs
+TEST(Views, OksAndErrs)
+{
+    std::vector<Result<int, std::string>> const results = MakeResults();
+
+    EXPECT_EQ(ToVector(results | views::oks), (std::vector<int>{1, 3}));
+    EXPECT_EQ(ToVector(results | views::errs), (std::vector<std::string>{"a", "b"}));
+}
+#pragma endregion
+
+#pragma region views::take_while_ok
+TEST(Views, TakeWhileOk)
+{
+    std::vector<Result<int, std::string>> const results = MakeResults();
+
+    EXPECT_EQ(ToVector(results | views::take_while_ok), (std::vector<int>{1}));
+}
+
+TEST(Views, TakeWhileOk_Unbounded)
+{
+    auto results = std::views::iota(0) |
+                   std::views::transform([](int i) { return i < 4 ? Ok<int, int>(i) : Err<int, int>(i); }) |
+                   views::take_while_ok;
+
+    EXPECT_EQ(ToVector(results), (std::vector<int>{0, 1, 2, 3}));
+}
+#pragma endregion
+
+#pragma region views::and_then / views::map_ok
+TEST(Views, AndThen)
+{
+    std::vector<Result<int, std::string>> const results = MakeResults();
+    auto halve = [](int x) { return x % 2 ? Err<int, std::string>("odd") : Ok<int, std::string>(x / 2); };
+
+    auto mapped = results | views::and_then(halve);
+    static_assert(std::ranges::sized_range<decltype(mapped)>);
+
+    std::vector<Result<int, std::string>> const actual = ToVector(mapped);
+    ASSERT_EQ(actual.size(), 4);
+    EXPECT_EQ(actual[0].UnwrapErr(), "odd");
+    EXPECT_EQ(actual[1].UnwrapErr(), "a");
+}
+
+TEST(Views, AndThen_Option)
+{
+    std::vector<Option<int>> const options{Some(4), None, Some(-1)};
+    auto positive = [](int x) { return x > 0 ? Some(x) : NoneT<int>(); };
+
+    EXPECT_EQ(ToVector(options | views::and_then(positive)), (std::vector<Option<int>>{Some(4), None, None}));
+}
+
+TEST(Views, MapOk)
+{
+    std::vector<Result<int, std::string>> const results = MakeResults();
+
+    std::vector<Result<double, std::string>> const actual =
+        ToVector(results | views::map_ok([](int x) { return x * 0.5; }));
+
+    ASSERT_EQ(actual.size(), 4);
+    EXPECT_EQ(actual[0].Unwrap(), 0.5);
+    EXPECT_EQ(actual[3].UnwrapErr(), "b");
+}
+
+TEST(Views, MapOk_ComposesWithOks)
+{
+    std::vector<Option<int>> const options{Some(1), None, Some(2)};
+
+    auto doubled = options | views::map_ok([](int x) { return x * 2; }) | views::somes;
+
+    EXPECT_EQ(ToVector(doubled), (std::vector<int>{2, 4}));
+}
+#pragma endregion